@@ -35,7 +35,9 @@
 
 #include "ImporterWorker.h"
 
+#include <QtConcurrent>
 #include <QtCore/QCoreApplication>
+#include <QtCore/QMutexLocker>
 
 #include <iostream>
 
@@ -47,6 +49,8 @@
 // -----------------------------------------------------------------------------
 ImporterWorker::ImporterWorker()
 : m_QueueModel(nullptr)
+, m_MaxConcurrentImports(1)
+, m_MemoryBudget(0)
 , m_ImportSem(1)
 {
 }
@@ -56,6 +60,7 @@ ImporterWorker::ImporterWorker()
 // -----------------------------------------------------------------------------
 ImporterWorker::~ImporterWorker()
 {
+  m_ImportPool.waitForDone();
 }
 
 // -----------------------------------------------------------------------------
@@ -63,7 +68,50 @@ ImporterWorker::~ImporterWorker()
 // -----------------------------------------------------------------------------
 void ImporterWorker::setQueueModel(VSQueueModel* queueModel)
 {
+  if(m_QueueModel)
+  {
+    disconnect(m_QueueModel, &VSQueueModel::rowsInserted, this, nullptr);
+  }
+
   m_QueueModel = queueModel;
+
+  if(m_QueueModel)
+  {
+    // Importers added while the queue is executing wake the worker if it is waiting
+    connect(m_QueueModel, &VSQueueModel::rowsInserted, this, [this] { wakeWorker(); }, Qt::DirectConnection);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ImporterWorker::getMaxConcurrentImports() const
+{
+  return m_MaxConcurrentImports;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImporterWorker::setMaxConcurrentImports(int count)
+{
+  m_MaxConcurrentImports = count < 1 ? 1 : count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImporterWorker::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImporterWorker::setMemoryBudget(size_t bytes)
+{
+  m_MemoryBudget = bytes;
 }
 
 // -----------------------------------------------------------------------------
@@ -71,8 +119,40 @@ void ImporterWorker::setQueueModel(VSQueueModel* queueModel)
 // -----------------------------------------------------------------------------
 void ImporterWorker::cancelWorker()
 {
+  QMutexLocker locker(&m_RunningLock);
   m_Cancelled = true;
-  m_CurrentImporter->cancel();
+  for(const RunningImport& runningImport : m_RunningImports)
+  {
+    runningImport.m_Importer->cancel();
+  }
+  m_ImportChanged.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImporterWorker::wakeWorker()
+{
+  QMutexLocker locker(&m_RunningLock);
+  m_ImportChanged.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImporterWorker::finishImport(const VSAbstractImporter::Pointer& importer)
+{
+  QMutexLocker locker(&m_RunningLock);
+  for(auto iter = m_RunningImports.begin(); iter != m_RunningImports.end(); iter++)
+  {
+    if(iter->m_Importer == importer)
+    {
+      m_MemoryInUse -= iter->m_EstimatedMemory;
+      m_RunningImports.erase(iter);
+      break;
+    }
+  }
+  m_ImportChanged.wakeAll();
 }
 
 // -----------------------------------------------------------------------------
@@ -83,33 +163,77 @@ void ImporterWorker::process()
   m_QueueModel->startQueue();
 
   m_Cancelled = false;
+  m_MemoryInUse = 0;
 
   m_CurrentIndex = m_QueueModel->index(0, VSQueueItem::ItemData::Contents);
+  m_ImportPool.setMaxThreadCount(m_MaxConcurrentImports);
 
-  m_ImportSem.acquire();
-  while(m_CurrentIndex.isValid() && m_CurrentIndex.row() < m_QueueModel->rowCount())
+  while(true)
   {
-    m_ImportSem.release();
-
     QCoreApplication::processEvents();
 
+    QMutexLocker locker(&m_RunningLock);
     if(m_Cancelled)
     {
+      // Running importers were asked to cancel by cancelWorker
+      locker.unlock();
+      m_ImportPool.waitForDone();
       emit finished();
       return;
     }
 
-    m_CurrentImporter = m_QueueModel->data(m_CurrentIndex, VSQueueModel::Roles::ImporterRole).value<VSAbstractImporter::Pointer>();
+    m_ImportSem.acquire();
+    bool hasNext = m_CurrentIndex.isValid() && m_CurrentIndex.row() < m_QueueModel->rowCount();
+    m_ImportSem.release();
+
+    size_t runningCount = m_RunningImports.size();
+    if(!hasNext)
+    {
+      if(runningCount == 0)
+      {
+        break;
+      }
+
+      // Wait for a running importer to finish or for more importers to be queued
+      m_ImportChanged.wait(&m_RunningLock);
+      continue;
+    }
+
+    if(runningCount >= static_cast<size_t>(m_MaxConcurrentImports))
+    {
+      m_ImportChanged.wait(&m_RunningLock);
+      continue;
+    }
 
-    if(m_CurrentImporter && m_CurrentImporter->getState() == VSAbstractImporter::State::Ready)
+    VSAbstractImporter::Pointer importer = m_QueueModel->data(m_CurrentIndex, VSQueueModel::Roles::ImporterRole).value<VSAbstractImporter::Pointer>();
+    if(importer && importer->getState() == VSAbstractImporter::State::Ready)
     {
-      m_CurrentImporter->execute();
+      // Importers start in queue order.  One that does not fit the remaining budget waits for
+      // running importers to finish, but is always allowed to run on its own.
+      size_t estimatedMemory = importer->getEstimatedMemory();
+      size_t memoryBudget = m_MemoryBudget;
+      if(memoryBudget > 0 && runningCount > 0 && m_MemoryInUse + estimatedMemory > memoryBudget)
+      {
+        m_ImportChanged.wait(&m_RunningLock);
+        continue;
+      }
+
+      RunningImport runningImport;
+      runningImport.m_Importer = importer;
+      runningImport.m_EstimatedMemory = estimatedMemory;
+      m_RunningImports.push_back(runningImport);
+      m_MemoryInUse += estimatedMemory;
+
+      QtConcurrent::run(&m_ImportPool, [this, importer] {
+        importer->execute();
+        finishImport(importer);
+      });
     }
 
     m_ImportSem.acquire();
     m_CurrentIndex = m_QueueModel->index(m_CurrentIndex.row() + 1, VSQueueItem::ItemData::Contents);
+    m_ImportSem.release();
   }
-  m_ImportSem.release();
 
   emit finished();
 }
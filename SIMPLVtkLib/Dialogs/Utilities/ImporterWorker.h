@@ -35,10 +35,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
+
 #include <qthread.h>
 
+#include <QtCore/QMutex>
 #include <QtCore/QPersistentModelIndex>
 #include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+#include <QtCore/QWaitCondition>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 
@@ -59,6 +65,33 @@ public:
 
   void setQueueModel(VSQueueModel* queueModel);
 
+  /**
+   * @brief Returns the maximum number of importers that may execute at the same time
+   * @return
+   */
+  int getMaxConcurrentImports() const;
+
+  /**
+   * @brief Sets the maximum number of importers that may execute at the same time.
+   * A value of 1 executes the queue in order, one importer at a time.
+   * @param count
+   */
+  void setMaxConcurrentImports(int count);
+
+  /**
+   * @brief Returns the memory budget in bytes shared by executing importers
+   * @return
+   */
+  size_t getMemoryBudget() const;
+
+  /**
+   * @brief Sets the memory budget in bytes shared by executing importers.  An importer only
+   * starts once its estimated memory fits in the remaining budget, unless nothing else is
+   * executing.  A value of 0 disables the budget.
+   * @param bytes
+   */
+  void setMemoryBudget(size_t bytes);
+
 public slots:
   void cancelWorker();
 
@@ -70,11 +103,36 @@ public slots:
   void process();
 
 private:
+  struct RunningImport
+  {
+    VSAbstractImporter::Pointer m_Importer;
+    size_t m_EstimatedMemory = 0;
+  };
+
+  /**
+   * @brief Removes the finished importer from the running list, returns its memory to the
+   * budget, and wakes the worker.  Called from the import thread pool.
+   * @param importer
+   */
+  void finishImport(const VSAbstractImporter::Pointer& importer);
+
+  /**
+   * @brief Wakes the worker if it is waiting for an importer to finish or be queued
+   */
+  void wakeWorker();
+
   VSQueueModel* m_QueueModel = nullptr;
   bool m_Cancelled = false;
-  VSAbstractImporter::Pointer m_CurrentImporter;
   QPersistentModelIndex m_CurrentIndex;
 
+  std::atomic_int m_MaxConcurrentImports;
+  std::atomic<size_t> m_MemoryBudget;
+  size_t m_MemoryInUse = 0;
+  std::list<RunningImport> m_RunningImports;
+  QMutex m_RunningLock;
+  QWaitCondition m_ImportChanged;
+  QThreadPool m_ImportPool;
+
   typedef std::vector<VSAbstractImporter::Pointer> ExecutionQueue;
 
   QSemaphore m_ImportSem;
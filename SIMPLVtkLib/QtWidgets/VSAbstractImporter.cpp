@@ -59,3 +59,19 @@ void VSAbstractImporter::setState(VSAbstractImporter::State state)
   m_State = state;
   emit stateChanged(this, state);
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSAbstractImporter::getEstimatedMemory() const
+{
+  return m_EstimatedMemory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractImporter::setEstimatedMemory(size_t bytes)
+{
+  m_EstimatedMemory = bytes;
+}
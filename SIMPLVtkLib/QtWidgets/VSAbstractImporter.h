@@ -88,6 +88,19 @@ public:
    */
   virtual void reset() = 0;
 
+  /**
+   * @brief Returns the estimated number of bytes required while executing.  Used by the
+   * import queue to decide whether the importer fits in its memory budget.  Returns 0 if unknown.
+   * @return
+   */
+  virtual size_t getEstimatedMemory() const;
+
+  /**
+   * @brief Overrides the estimated number of bytes required while executing
+   * @param bytes
+   */
+  void setEstimatedMemory(size_t bytes);
+
 signals:
   void stateChanged(VSAbstractImporter* importer, VSAbstractImporter::State state);
   void notifyMessage(const AbstractMessage::Pointer& msg);
@@ -98,6 +111,7 @@ protected:
 private:
   State m_State = State::Ready;
   bool m_Canceled = false;
+  size_t m_EstimatedMemory = 0;
 };
 Q_DECLARE_METATYPE(VSAbstractImporter::Pointer)
 Q_DECLARE_METATYPE(VSAbstractImporter::State)
@@ -35,12 +35,17 @@
 
 #include "VSViewWidget.h"
 
+#include <algorithm>
+
 #include <QtGui/QKeyEvent>
 #include <QtWidgets/QLayout>
 #include <QtWidgets/QStyle>
 
+#include <vtkRenderer.h>
+
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSRootFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
 
 namespace
 {
@@ -55,6 +60,7 @@ VSAbstractViewWidget::VSAbstractViewWidget(QWidget* parent, Qt::WindowFlags wind
 : QFrame(parent, windowFlags)
 {
   setupModel();
+  setupRenderScheduler();
 }
 
 // -----------------------------------------------------------------------------
@@ -63,8 +69,23 @@ VSAbstractViewWidget::VSAbstractViewWidget(QWidget* parent, Qt::WindowFlags wind
 VSAbstractViewWidget::VSAbstractViewWidget(const VSAbstractViewWidget& other)
 : QFrame(nullptr)
 , m_Controller(other.m_Controller)
+, m_MaxFramesPerSecond(other.m_MaxFramesPerSecond)
+, m_StreamingTiles(other.m_StreamingTiles)
+, m_StreamingMargin(other.m_StreamingMargin)
+, m_MergingMontageTiles(other.m_MergingMontageTiles)
 {
   setupModel();
+  setupRenderScheduler();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::setupRenderScheduler()
+{
+  m_RenderTimer = new QTimer(this);
+  m_RenderTimer->setSingleShot(true);
+  connect(m_RenderTimer, &QTimer::timeout, this, &VSAbstractViewWidget::renderNow);
 }
 
 // -----------------------------------------------------------------------------
@@ -102,6 +123,8 @@ void VSAbstractViewWidget::copyModel(const VSFilterViewModel& other)
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::addViewSettings(VSFilterViewSettings* viewSettings)
 {
+  m_PickIndex.invalidate();
+
   connect(viewSettings, &VSFilterViewSettings::visibilityChanged, this, &VSAbstractViewWidget::setFilterVisibility);
   connect(viewSettings, &VSFilterViewSettings::gridVisibilityChanged, this, &VSAbstractViewWidget::setGridVisibility);
   connect(viewSettings, &VSFilterViewSettings::activeArrayNameChanged, this, &VSAbstractViewWidget::setFilterArrayName);
@@ -110,6 +133,8 @@ void VSAbstractViewWidget::addViewSettings(VSFilterViewSettings* viewSettings)
   connect(viewSettings, &VSFilterViewSettings::showScalarBarChanged, this, &VSAbstractViewWidget::setFilterShowScalarBar);
   connect(viewSettings, &VSFilterViewSettings::requiresRender, this, &VSAbstractViewWidget::renderView);
   connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, &VSAbstractViewWidget::updateScene);
+  connect(viewSettings, &VSFilterViewSettings::swappingActors, this, &VSAbstractViewWidget::swapActors);
+  connect(viewSettings->getFilter(), &VSAbstractFilter::updatedOutputPort, this, [this] { m_PickIndex.invalidate(); });
 
   checkFilterViewSetting(viewSettings);
 
@@ -124,6 +149,8 @@ void VSAbstractViewWidget::addViewSettings(VSFilterViewSettings* viewSettings)
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::removeViewSettings(VSFilterViewSettings* viewSettings)
 {
+  m_PickIndex.invalidate();
+
   if(viewSettings)
   {
     changeFilterVisibility(viewSettings, false);
@@ -260,6 +287,8 @@ VSFilterViewSettings::Map VSAbstractViewWidget::getAllFilterViewSettings() const
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::changeFilterVisibility(VSFilterViewSettings* viewSettings, const bool& filterVisible)
 {
+  m_PickIndex.invalidate();
+
   if(nullptr == viewSettings)
   {
     return;
@@ -281,7 +310,11 @@ void VSAbstractViewWidget::changeFilterVisibility(VSFilterViewSettings* viewSett
 
   if(filterVisible)
   {
-    getVisualizationWidget()->getRenderer()->AddViewProp(viewSettings->getActor());
+    // Merged tiles are drawn through the montage atlases
+    if(!isMergedTile(viewSettings->getActor()))
+    {
+      getVisualizationWidget()->getRenderer()->AddViewProp(viewSettings->getActor());
+    }
 
     if(viewSettings->isScalarBarVisible())
     {
@@ -406,8 +439,19 @@ void VSAbstractViewWidget::setGridVisibility(const bool& gridVisible)
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::swapActors(vtkProp3D* oldProp, vtkProp3D* newProp)
 {
-  getVisualizationWidget()->getRenderer()->RemoveViewProp(oldProp);
-  getVisualizationWidget()->getRenderer()->AddViewProp(newProp);
+  m_PickIndex.invalidate();
+  if(nullptr == getVisualizationWidget())
+  {
+    return;
+  }
+
+  // Merged montage tiles are drawn through their atlas instead of their own actor
+  vtkRenderer* renderer = getVisualizationWidget()->getRenderer();
+  if(renderer->HasViewProp(oldProp))
+  {
+    renderer->RemoveViewProp(oldProp);
+    renderer->AddViewProp(newProp);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -661,6 +705,32 @@ void VSAbstractViewWidget::setBlockRender(bool block)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::beginRenderBatch()
+{
+  m_RenderBatchDepth++;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::endRenderBatch()
+{
+  if(m_RenderBatchDepth <= 0)
+  {
+    return;
+  }
+
+  m_RenderBatchDepth--;
+  if(0 == m_RenderBatchDepth && m_RenderBatchPending)
+  {
+    m_RenderBatchPending = false;
+    scheduleRender();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -671,13 +741,202 @@ void VSAbstractViewWidget::renderView()
     return;
   }
 
+  m_RequestedRenderCount++;
+  if(m_RenderBatchDepth > 0)
+  {
+    m_RenderBatchPending = true;
+    return;
+  }
+
+  scheduleRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::scheduleRender()
+{
+  if(m_RenderTimer->isActive())
+  {
+    return;
+  }
+
+  int delay = 0;
+  if(m_MaxFramesPerSecond > 0 && m_LastRenderTime.isValid())
+  {
+    qint64 frameInterval = 1000 / m_MaxFramesPerSecond;
+    delay = static_cast<int>(std::max<qint64>(0, frameInterval - m_LastRenderTime.elapsed()));
+  }
+  m_RenderTimer->start(delay);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::renderNow()
+{
+  m_RenderTimer->stop();
+  if(m_BlockRender)
+  {
+    return;
+  }
+
   VSVisualizationWidget* visualizationWidget = getVisualizationWidget();
   if(visualizationWidget)
   {
+    // Camera and viewport changes since the last frame are resolved once per render
+    updateStreamedTiles();
+    updateMergedMontage();
+    m_ExecutedRenderCount++;
+    m_LastRenderTime.start();
     visualizationWidget->render();
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractViewWidget::isMergingMontageTiles() const
+{
+  return m_MergingMontageTiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::setMergingMontageTiles(bool merge)
+{
+  if(m_MergingMontageTiles == merge)
+  {
+    return;
+  }
+
+  m_MergingMontageTiles = merge;
+  renderView();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractViewWidget::isMergedTile(vtkProp3D* prop) const
+{
+  return m_MergingMontageTiles && m_MergedMontage.contains(prop);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::updateMergedMontage()
+{
+  VSVisualizationWidget* visualizationWidget = getVisualizationWidget();
+  if(nullptr == visualizationWidget || nullptr == visualizationWidget->getRenderer())
+  {
+    return;
+  }
+  if(!m_MergingMontageTiles && 0 == m_MergedMontage.getNumberOfTiles())
+  {
+    return;
+  }
+
+  vtkRenderer* renderer = visualizationWidget->getRenderer();
+  for(const VTK_PTR(vtkActor)& actor : m_MergedMontage.getActors())
+  {
+    renderer->RemoveViewProp(actor);
+  }
+
+  VSFilterViewSettings::Map allFilterViewSettings = getAllFilterViewSettings();
+  VSFilterViewSettings::Collection tiles;
+  if(m_MergingMontageTiles)
+  {
+    for(const auto& settingPair : allFilterViewSettings)
+    {
+      VSFilterViewSettings* settings = settingPair.second;
+      if(settings->isValid() && settings->isVisible() && VSFilterViewSettings::ActorType::Image2D == settings->getActorType())
+      {
+        tiles.push_back(settings);
+      }
+    }
+  }
+
+  std::unordered_set<vtkProp3D*> previousProps = m_MergedMontage.getMergedProps();
+  if(tiles.empty())
+  {
+    m_MergedMontage.clear();
+  }
+  else
+  {
+    m_MergedMontage.update(tiles);
+  }
+
+  // Only swap actors whose merged state changed to avoid linear renderer lookups for every tile
+  for(const auto& settingPair : allFilterViewSettings)
+  {
+    VSFilterViewSettings* settings = settingPair.second;
+    vtkProp3D* actor = settings->getActor();
+    if(nullptr == actor)
+    {
+      continue;
+    }
+
+    bool wasMerged = previousProps.find(actor) != previousProps.end();
+    bool isMerged = m_MergedMontage.contains(actor);
+    if(isMerged && !wasMerged)
+    {
+      renderer->RemoveViewProp(actor);
+    }
+    else if(wasMerged && !isMerged && settings->isValid() && settings->isVisible())
+    {
+      renderer->AddViewProp(actor);
+    }
+  }
+
+  for(const VTK_PTR(vtkActor)& actor : m_MergedMontage.getActors())
+  {
+    renderer->AddViewProp(actor);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSAbstractViewWidget::getMaxFramesPerSecond() const
+{
+  return m_MaxFramesPerSecond;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::setMaxFramesPerSecond(int fps)
+{
+  m_MaxFramesPerSecond = fps;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSAbstractViewWidget::getRequestedRenderCount() const
+{
+  return m_RequestedRenderCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSAbstractViewWidget::getExecutedRenderCount() const
+{
+  return m_ExecutedRenderCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::resetRenderCounts()
+{
+  m_RequestedRenderCount = 0;
+  m_ExecutedRenderCount = 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -701,6 +960,7 @@ void VSAbstractViewWidget::resetCamera()
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::updateScene()
 {
+  m_PickIndex.invalidate();
   renderView();
   resetCamera();
 }
@@ -758,6 +1018,7 @@ void VSAbstractViewWidget::setController(VSController* controller)
 
   // Set the new VSFilterModel base
   m_FilterViewModel->setFilterModel(controller->getFilterModel());
+  m_PickIndex.invalidate();
 
   std::vector<VSFilterViewSettings*> filterViewSettings = m_FilterViewModel->getAllFilterViewSettings();
   for(VSFilterViewSettings* viewSettings : filterViewSettings)
@@ -769,6 +1030,8 @@ void VSAbstractViewWidget::setController(VSController* controller)
     connect(viewSettings, &VSFilterViewSettings::showScalarBarChanged, this, &VSAbstractViewWidget::setFilterShowScalarBar);
     connect(viewSettings, &VSFilterViewSettings::requiresRender, this, &VSAbstractViewWidget::renderView);
     connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, &VSAbstractViewWidget::updateScene);
+    connect(viewSettings, &VSFilterViewSettings::swappingActors, this, &VSAbstractViewWidget::swapActors);
+    connect(viewSettings->getFilter(), &VSAbstractFilter::updatedOutputPort, this, [this] { m_PickIndex.invalidate(); });
 
     // Check filter and scalar bar visibility
     checkFilterViewSetting(viewSettings);
@@ -795,16 +1058,20 @@ VSAbstractFilter* VSAbstractViewWidget::getFilterFromProp(vtkProp3D* prop)
     return nullptr;
   }
 
-  // Compare prop with all VSFilterViewSettings to find a match
-  for(std::pair<VSAbstractFilter*, VSFilterViewSettings*> settingPair : getAllFilterViewSettings())
+  return getPickIndex().getFilter(prop);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const VSPickIndex& VSAbstractViewWidget::getPickIndex()
+{
+  if(!m_PickIndex.isValid())
   {
-    if(settingPair.second->getActor() == prop)
-    {
-      return settingPair.first;
-    }
+    m_PickIndex.rebuild(getAllFilterViewSettings());
   }
 
-  return nullptr;
+  return m_PickIndex;
 }
 
 // -----------------------------------------------------------------------------
@@ -901,6 +1168,141 @@ VSAbstractFilter::FilterListType VSAbstractViewWidget::getSelectedFilters() cons
   return m_FilterViewModel->getFiltersFromIndexes(selection);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractViewWidget::isStreamingTiles() const
+{
+  return m_StreamingTiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::setStreamingTiles(bool streaming)
+{
+  m_StreamingTiles = streaming;
+  if(m_StreamTilesAction && m_StreamTilesAction->isChecked() != streaming)
+  {
+    m_StreamTilesAction->setChecked(streaming);
+  }
+
+  if(streaming)
+  {
+    updateStreamedTiles();
+    return;
+  }
+
+  // Bring back everything that was evicted while streaming
+  VSFilterViewSettings::Map allFilterViewSettings = getAllFilterViewSettings();
+  for(auto iter = allFilterViewSettings.begin(); iter != allFilterViewSettings.end(); iter++)
+  {
+    VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(iter->first);
+    if(dcFilter)
+    {
+      dcFilter->restoreData();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QAction* VSAbstractViewWidget::getStreamTilesAction()
+{
+  if(nullptr == m_StreamTilesAction)
+  {
+    m_StreamTilesAction = new QAction("Stream Montage Tiles", this);
+    m_StreamTilesAction->setCheckable(true);
+    m_StreamTilesAction->setChecked(m_StreamingTiles);
+    connect(m_StreamTilesAction, &QAction::toggled, this, &VSAbstractViewWidget::setStreamingTiles);
+  }
+
+  return m_StreamTilesAction;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSAbstractViewWidget::getStreamingMargin() const
+{
+  return m_StreamingMargin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::setStreamingMargin(double margin)
+{
+  m_StreamingMargin = margin < 0.0 ? 0.0 : margin;
+  updateStreamedTiles();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::updateStreamedTiles()
+{
+  if(!m_StreamingTiles || nullptr == getVisualizationWidget())
+  {
+    return;
+  }
+
+  vtkRenderer* renderer = getVisualizationWidget()->getRenderer();
+  if(nullptr == renderer)
+  {
+    return;
+  }
+
+  // Expand the viewport by the prefetch margin
+  int* viewSize = renderer->GetSize();
+  double marginX = viewSize[0] * m_StreamingMargin;
+  double marginY = viewSize[1] * m_StreamingMargin;
+  double viewMin[2] = {-marginX, -marginY};
+  double viewMax[2] = {viewSize[0] + marginX, viewSize[1] + marginY};
+
+  VSFilterViewSettings::Map allFilterViewSettings = getAllFilterViewSettings();
+  for(auto iter = allFilterViewSettings.begin(); iter != allFilterViewSettings.end(); iter++)
+  {
+    VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(iter->first);
+    VSFilterViewSettings* settings = iter->second;
+    if(nullptr == dcFilter || !dcFilter->canStreamData() || nullptr == settings->getActor())
+    {
+      continue;
+    }
+
+    bool inView = false;
+    if(settings->isVisible())
+    {
+      double* bounds = settings->getActor()->GetBounds();
+      double displayMin[2] = {VTK_DOUBLE_MAX, VTK_DOUBLE_MAX};
+      double displayMax[2] = {VTK_DOUBLE_MIN, VTK_DOUBLE_MIN};
+      for(int corner = 0; corner < 8; corner++)
+      {
+        renderer->SetWorldPoint(bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)], bounds[4 + ((corner >> 2) & 1)], 1.0);
+        renderer->WorldToDisplay();
+        double* displayPoint = renderer->GetDisplayPoint();
+        for(int i = 0; i < 2; i++)
+        {
+          displayMin[i] = std::min(displayMin[i], displayPoint[i]);
+          displayMax[i] = std::max(displayMax[i], displayPoint[i]);
+        }
+      }
+
+      inView = displayMax[0] >= viewMin[0] && displayMin[0] <= viewMax[0] && displayMax[1] >= viewMin[1] && displayMin[1] <= viewMax[1];
+    }
+
+    if(inView)
+    {
+      dcFilter->restoreData();
+    }
+    else
+    {
+      dcFilter->evictData();
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -37,13 +37,18 @@
 
 #include <vector>
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QItemSelectionModel>
+#include <QtCore/QTimer>
+#include <QtWidgets/QAction>
 #include <QtWidgets/QFrame>
 #include <QtWidgets/QSplitter>
 
 #include "SIMPLVtkLib/QtWidgets/VSVisualizationWidget.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSMergedMontage.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSPickIndex.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
@@ -151,6 +156,14 @@ public:
    */
   virtual VSAbstractFilter* getFilterFromProp(vtkProp3D* prop);
 
+  /**
+   * @brief Returns the spatial index over the actors displayed in the view.  The
+   * index is rebuilt if any filter was added, removed, hidden, or moved since it
+   * was last used.
+   * @return
+   */
+  const VSPickIndex& getPickIndex();
+
   /**
    * @brief Returns the visualization filter based on the given mouse coordinates.
    * @param pos
@@ -184,6 +197,101 @@ public:
    */
   VSAbstractFilter* getCurrentFilter() const;
 
+  /**
+   * @brief Returns true if tile streaming is enabled for the view.  Returns false otherwise.
+   * @return
+   */
+  bool isStreamingTiles() const;
+
+  /**
+   * @brief Sets whether or not the view streams montage tiles.  When streaming, flat
+   * SIMPL images outside the viewport are evicted from memory and read from their
+   * .dream3d file again when they come back into view.  Files opened while streaming
+   * import their flat images without array values.
+   * @param streaming
+   */
+  void setStreamingTiles(bool streaming);
+
+  /**
+   * @brief Returns a checkable QAction for toggling tile streaming
+   * @return
+   */
+  QAction* getStreamTilesAction();
+
+  /**
+   * @brief Returns the prefetch margin as a fraction of the viewport size
+   * @return
+   */
+  double getStreamingMargin() const;
+
+  /**
+   * @brief Sets the prefetch margin as a fraction of the viewport size.  Tiles within
+   * the margin are kept in memory so that panning does not immediately require a read.
+   * @param margin
+   */
+  void setStreamingMargin(double margin);
+
+  /**
+   * @brief Evicts or restores streamed tiles based on whether they intersect the
+   * viewport and prefetch margin.  Does nothing unless tile streaming is enabled.
+   */
+  void updateStreamedTiles();
+
+  /**
+   * @brief Returns true if flat image tiles are drawn through merged texture atlases.
+   * Returns false otherwise.
+   * @return
+   */
+  bool isMergingMontageTiles() const;
+
+  /**
+   * @brief Sets whether flat image tiles are drawn through merged texture atlases
+   * instead of one actor per tile.  This keeps the number of actors and texture
+   * binds small for montages with many tiles.
+   * @param merge
+   */
+  void setMergingMontageTiles(bool merge);
+
+  /**
+   * @brief Returns true if the given actor is a tile drawn through a merged texture atlas
+   * @param prop
+   * @return
+   */
+  bool isMergedTile(vtkProp3D* prop) const;
+
+  /**
+   * @brief Returns the maximum number of frames per second rendered by the view
+   * @return
+   */
+  int getMaxFramesPerSecond() const;
+
+  /**
+   * @brief Sets the maximum number of frames per second rendered by the view.
+   * Render requests arriving faster than this are coalesced into a single render.
+   * Values less than 1 only coalesce requests made before control returns to the
+   * event loop.
+   * @param fps
+   */
+  void setMaxFramesPerSecond(int fps);
+
+  /**
+   * @brief Returns the number of times a render was requested through renderView
+   * since the counts were last reset
+   * @return
+   */
+  size_t getRequestedRenderCount() const;
+
+  /**
+   * @brief Returns the number of renders actually performed since the counts were last reset
+   * @return
+   */
+  size_t getExecutedRenderCount() const;
+
+  /**
+   * @brief Resets the requested and executed render counts
+   */
+  void resetRenderCounts();
+
 signals:
   void viewWidgetClosed();
   void markActive(VSAbstractViewWidget*);
@@ -219,10 +327,18 @@ public slots:
   void closeView();
 
   /**
-   * @brief Renders the visualization widget
+   * @brief Requests that the visualization widget be rendered.  Requests are
+   * coalesced so that the view renders at most once per frame interval.
    */
   void renderView();
 
+  /**
+   * @brief Renders the visualization widget immediately, including any pending
+   * render request.  Use this when the rendered image is needed right away such
+   * as when saving a screenshot.
+   */
+  void renderNow();
+
   /**
    * @brief Resets the visualization widget's camera
    */
@@ -239,6 +355,18 @@ public slots:
    */
   void setBlockRender(bool block);
 
+  /**
+   * @brief Defers render requests until the matching endRenderBatch call.  Batches
+   * can be nested and a single render is performed when the outermost batch ends
+   * if any render was requested.
+   */
+  void beginRenderBatch();
+
+  /**
+   * @brief Ends a batch started with beginRenderBatch
+   */
+  void endRenderBatch();
+
   /**
    * @brief Select the given filter
    * @param filter
@@ -332,6 +460,23 @@ protected:
    */
   void copyModel(const VSFilterViewModel& other);
 
+  /**
+   * @brief Creates the timer used to coalesce render requests
+   */
+  void setupRenderScheduler();
+
+  /**
+   * @brief Starts the render timer if it is not already running so that the next
+   * render happens no sooner than one frame interval after the previous one
+   */
+  void scheduleRender();
+
+  /**
+   * @brief Updates the merged montage atlases and swaps the merged tile actors out
+   * of the renderer.  Restores the tile actors when merging is disabled.
+   */
+  void updateMergedMontage();
+
   /**
    * @brief Adds a new VSFilterViewSettings object and makes necessary connections
    * @param viewSettings
@@ -454,5 +599,18 @@ private:
   QItemSelectionModel* m_SelectionModel = nullptr;
   VSController* m_Controller = nullptr;
   bool m_BlockRender = false;
+  int m_RenderBatchDepth = 0;
+  bool m_RenderBatchPending = false;
+  QTimer* m_RenderTimer = nullptr;
+  QElapsedTimer m_LastRenderTime;
+  int m_MaxFramesPerSecond = 60;
+  size_t m_RequestedRenderCount = 0;
+  size_t m_ExecutedRenderCount = 0;
   bool m_Active = false;
+  bool m_StreamingTiles = false;
+  QAction* m_StreamTilesAction = nullptr;
+  double m_StreamingMargin = 0.25;
+  VSPickIndex m_PickIndex;
+  VSMergedMontage m_MergedMontage;
+  bool m_MergingMontageTiles = false;
 };
@@ -231,10 +231,7 @@ void VSColorMappingWidget::setScalarsMapped(int colorMappingIndex)
   }
 
   VSFilterViewSettings::ColorMapping colorMapping = static_cast<VSFilterViewSettings::ColorMapping>(colorMappingIndex);
-  for(VSFilterViewSettings* settings : m_ViewSettings)
-  {
-    settings->setMapColors(colorMapping);
-  }
+  VSFilterViewSettings::SetMapColors(m_ViewSettings, colorMapping);
 }
 
 // -----------------------------------------------------------------------------
@@ -254,10 +251,7 @@ void VSColorMappingWidget::setScalarBarSetting(int index)
   }
 
   VSFilterViewSettings::ScalarBarSetting setting = static_cast<VSFilterViewSettings::ScalarBarSetting>(index);
-  for(VSFilterViewSettings* settings : m_ViewSettings)
-  {
-    settings->setScalarBarSetting(setting);
-  }
+  VSFilterViewSettings::SetScalarBarSetting(m_ViewSettings, setting);
 }
 
 // -----------------------------------------------------------------------------
@@ -278,10 +272,7 @@ void VSColorMappingWidget::selectPresetColors()
 // -----------------------------------------------------------------------------
 void VSColorMappingWidget::loadPresetColors(const QJsonObject& preset, const QPixmap& pixmap)
 {
-  for(VSFilterViewSettings* settings : m_ViewSettings)
-  {
-    settings->loadPresetColors(preset);
-  }
+  VSFilterViewSettings::LoadPresetColors(m_ViewSettings, preset);
 }
 
 // -----------------------------------------------------------------------------
@@ -289,10 +280,7 @@ void VSColorMappingWidget::loadPresetColors(const QJsonObject& preset, const QPi
 // -----------------------------------------------------------------------------
 void VSColorMappingWidget::invertScalarBar()
 {
-  for(VSFilterViewSettings* settings : m_ViewSettings)
-  {
-    settings->invertScalarBar();
-  }
+  VSFilterViewSettings::InvertScalarBar(m_ViewSettings);
 }
 
 // -----------------------------------------------------------------------------
@@ -300,10 +288,7 @@ void VSColorMappingWidget::invertScalarBar()
 // -----------------------------------------------------------------------------
 void VSColorMappingWidget::alphaSliderMoved(int value)
 {
-  for(VSFilterViewSettings* settings : m_ViewSettings)
-  {
-    settings->setAlpha(value / 100.0);
-  }
+  VSFilterViewSettings::SetAlpha(m_ViewSettings, value / 100.0);
 }
 
 // -----------------------------------------------------------------------------
@@ -36,6 +36,7 @@
 #include "VSDatasetImporter.h"
 
 #include <QtCore/QFileInfo>
+#include <QtCore/QThread>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
@@ -84,6 +85,17 @@ void VSDatasetImporter::execute()
   if(m_TextFilter == nullptr || m_DatasetFilter == nullptr)
   {
     cancel();
+    return;
+  }
+
+  // Start the read on the filter's thread now that the queue has admitted this importer.
+  // The filter reads its file on its own worker thread.  Hold this importer's
+  // queue slot until the read finishes so the memory budget stays accurate.
+  Qt::ConnectionType connectionType = (QThread::currentThread() == m_DatasetFilter->thread()) ? Qt::DirectConnection : Qt::BlockingQueuedConnection;
+  QMetaObject::invokeMethod(m_DatasetFilter, "startLoading", connectionType);
+  if(!m_DatasetFilter->waitForLoad() && getState() == State::Canceled)
+  {
+    return;
   }
 
   setState(State::Finished);
@@ -95,7 +107,11 @@ void VSDatasetImporter::execute()
 // -----------------------------------------------------------------------------
 void VSDatasetImporter::cancel()
 {
-  // Cancel
+  if(m_DatasetFilter != nullptr)
+  {
+    m_DatasetFilter->cancelLoad();
+  }
+
   setState(State::Canceled);
 }
 
@@ -107,3 +123,17 @@ void VSDatasetImporter::reset()
   // Cancel
   setState(State::Ready);
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSDatasetImporter::getEstimatedMemory() const
+{
+  size_t estimatedMemory = VSAbstractImporter::getEstimatedMemory();
+  if(estimatedMemory > 0 || nullptr == m_TextFilter)
+  {
+    return estimatedMemory;
+  }
+
+  return static_cast<size_t>(QFileInfo(m_TextFilter->getFilePath()).size());
+}
@@ -59,6 +59,12 @@ public:
 
   virtual void reset() override;
 
+  /**
+   * @brief Returns the size of the file being imported unless an estimate has been set
+   * @return
+   */
+  size_t getEstimatedMemory() const override;
+
 protected:
   VSDatasetImporter(VSFileNameFilter* textFilter, VSDataSetFilter* filter);
 
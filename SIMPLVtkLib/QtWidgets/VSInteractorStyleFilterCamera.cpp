@@ -35,13 +35,17 @@
 
 #include "VSInteractorStyleFilterCamera.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
 
 #include <vtkCamera.h>
 #include <vtkMath.h>
-#include <vtkPropPicker.h>
+#include <vtkCellPicker.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
+#include <vtkTransform.h>
 
 #include "SIMPLVtkLib/QtWidgets/VSAbstractViewWidget.h"
 #include "SIMPLVtkLib/QtWidgets/VSViewWidget.h"
@@ -50,6 +54,59 @@
 
 vtkStandardNewMacro(VSInteractorStyleFilterCamera);
 
+namespace
+{
+// Number of transform operations kept for undo
+const size_t s_MaxUndoOperations = 32;
+
+/**
+ * @brief Returns the parametric distance along the segment p0 + t * dir where it
+ * crosses the plane of the given planar bounds or a negative value if the segment
+ * misses the bounds.  The plane is normal to the axis with the smallest extent.
+ * @param bounds
+ * @param p0
+ * @param dir
+ * @return
+ */
+double intersectPlanarBounds(const double bounds[6], const double p0[3], const double dir[3])
+{
+  int normalAxis = 0;
+  for(int i = 1; i < 3; i++)
+  {
+    if(bounds[2 * i + 1] - bounds[2 * i] < bounds[2 * normalAxis + 1] - bounds[2 * normalAxis])
+    {
+      normalAxis = i;
+    }
+  }
+  if(std::abs(dir[normalAxis]) < std::numeric_limits<double>::epsilon())
+  {
+    return -1.0;
+  }
+
+  double planeCoord = (bounds[2 * normalAxis] + bounds[2 * normalAxis + 1]) / 2.0;
+  double t = (planeCoord - p0[normalAxis]) / dir[normalAxis];
+  if(t < 0.0 || t > 1.0)
+  {
+    return -1.0;
+  }
+
+  for(int i = 0; i < 3; i++)
+  {
+    if(i == normalAxis)
+    {
+      continue;
+    }
+    double coord = p0[i] + t * dir[i];
+    if(coord < bounds[2 * i] || coord > bounds[2 * i + 1])
+    {
+      return -1.0;
+    }
+  }
+
+  return t;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -82,6 +139,7 @@ void VSInteractorStyleFilterCamera::OnRightButtonDown()
   updateLinkedRenderWindows();
 
   determineSubsampling();
+  m_ViewWidget->updateStreamedTiles();
   // Cancel the current action
   cancelAction();
 }
@@ -148,6 +206,7 @@ void VSInteractorStyleFilterCamera::OnMouseWheelForward()
     vtkInteractorStyleTrackballCamera::OnMouseWheelForward();
   }
   updateLinkedRenderWindows();
+  m_ViewWidget->updateStreamedTiles();
 }
 
 // -----------------------------------------------------------------------------
@@ -165,6 +224,7 @@ void VSInteractorStyleFilterCamera::OnMouseWheelBackward()
     vtkInteractorStyleTrackballCamera::OnMouseWheelBackward();
   }
   updateLinkedRenderWindows();
+  m_ViewWidget->updateStreamedTiles();
 }
 
 // -----------------------------------------------------------------------------
@@ -536,14 +596,77 @@ VSInteractorStyleFilterCamera::FilterProp VSInteractorStyleFilterCamera::getFilt
 {
   vtkRenderer* renderer = this->GetDefaultRenderer();
 
-  FilterProp filterProp;
+  FilterProp filterProp(nullptr, nullptr);
+  if(nullptr == renderer || nullptr == m_ViewWidget)
+  {
+    return filterProp;
+  }
+
+  // Cast a ray from the near to the far clipping plane through the given position
+  double rayPoints[2][3];
+  for(int i = 0; i < 2; i++)
+  {
+    renderer->SetDisplayPoint(pos[0], pos[1], i);
+    renderer->DisplayToWorld();
+    double* worldPoint = renderer->GetWorldPoint();
+    for(int j = 0; j < 3; j++)
+    {
+      rayPoints[i][j] = (0.0 != worldPoint[3]) ? worldPoint[j] / worldPoint[3] : worldPoint[j];
+    }
+  }
+
+  // Only the actors whose bounds are crossed by the ray need to be picked precisely
+  std::vector<FilterProp> candidates = m_ViewWidget->getPickIndex().findCandidates(rayPoints[0], rayPoints[1]);
+  if(candidates.empty())
+  {
+    return filterProp;
+  }
+
+  if(nullptr == m_Picker)
+  {
+    m_Picker = vtkSmartPointer<vtkCellPicker>::New();
+    m_Picker->PickFromListOn();
+  }
+  m_Picker->InitializePickList();
+  for(const FilterProp& candidate : candidates)
+  {
+    m_Picker->AddPickList(candidate.first);
+  }
 
-  VTK_NEW(vtkPropPicker, picker);
-  picker->Pick(pos[0], pos[1], 0, renderer);
-  filterProp.first = picker->GetProp3D();
-  filterProp.second = m_ViewWidget->getFilterFromProp(filterProp.first);
+  double dir[3] = {rayPoints[1][0] - rayPoints[0][0], rayPoints[1][1] - rayPoints[0][1], rayPoints[1][2] - rayPoints[0][2]};
+  double pickDistance = std::numeric_limits<double>::max();
+  if(m_Picker->Pick(pos[0], pos[1], 0, renderer))
+  {
+    filterProp.first = m_Picker->GetProp3D();
+    filterProp.second = m_ViewWidget->getFilterFromProp(filterProp.first);
 
-  renderer->GetRenderWindow()->Render();
+    double pickOffset[3];
+    vtkMath::Subtract(m_Picker->GetPickPosition(), rayPoints[0], pickOffset);
+    double dirLength2 = vtkMath::Dot(dir, dir);
+    if(dirLength2 > 0.0)
+    {
+      pickDistance = vtkMath::Dot(pickOffset, dir) / dirLength2;
+    }
+  }
+  m_Picker->InitializePickList();
+
+  // Merged montage tiles are not in the renderer, so the picker cannot see them.
+  // Their geometry is planar, so the ray is intersected with their bounds instead
+  // and the tile closest to the camera wins over anything picked behind it.
+  for(const FilterProp& candidate : candidates)
+  {
+    if(!m_ViewWidget->isMergedTile(candidate.first))
+    {
+      continue;
+    }
+
+    double t = intersectPlanarBounds(candidate.first->GetBounds(), rayPoints[0], dir);
+    if(t >= 0.0 && t < pickDistance)
+    {
+      pickDistance = t;
+      filterProp = candidate;
+    }
+  }
 
   return filterProp;
 }
@@ -714,6 +837,8 @@ void VSInteractorStyleFilterCamera::setAxis(Axis axis)
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::endAction()
 {
+  commitTransformOperation();
+
   m_ActionType = ActionType::None;
   m_ActionAxis = Axis::None;
 }
@@ -723,20 +848,7 @@ void VSInteractorStyleFilterCamera::endAction()
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::cancelAction()
 {
-  switch(m_ActionType)
-  {
-  case ActionType::Translate:
-    cancelTranslation();
-    break;
-  case ActionType::Rotate:
-    cancelRotation();
-    break;
-  case ActionType::Scale:
-    cancelScaling();
-    break;
-  case ActionType::None:
-    break;
-  }
+  revertTransformOperation();
 
   m_ActionType = ActionType::None;
   m_ActionAxis = Axis::None;
@@ -760,7 +872,6 @@ void VSInteractorStyleFilterCamera::translateFilter()
 {
   if(nullptr == m_ActiveFilter || nullptr == m_ActiveProp)
   {
-    m_PreviousTransforms.clear();
     return;
   }
 
@@ -781,19 +892,15 @@ void VSInteractorStyleFilterCamera::translateFilter()
   deltaPosition[2] = new_pick_point[2] - old_pick_point[2];
 
   VSTransform* transform = m_ActiveFilter->getTransform();
-  double* globalPosition = transform->getPosition();
+  double globalPosition[3];
+  transform->getPosition(globalPosition);
   double localDelta[3];
   for(int i = 0; i < 3; i++)
   {
     localDelta[i] = deltaPosition[i] + globalPosition[i];
   }
-  delete[] globalPosition;
 
   transform->localizePoint(localDelta);
-  for(int i = 0; i < 3; i++)
-  {
-    m_Translation[i] += localDelta[i];
-  }
 
   // Check for custom transform
   if(m_CustomTransform)
@@ -824,16 +931,9 @@ void VSInteractorStyleFilterCamera::translateFilter()
   }
 
   // Translate all filters selected
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
-  for(VSAbstractFilter* filter : selection)
-  {
-    VSTransform* previousTransform = new VSTransform(*filter->getTransform());
-    previousTransform->setLocalPosition(filter->getTransform()->getLocalPosition());
-    previousTransform->setLocalScale(filter->getTransform()->getLocalScale());
-    previousTransform->setLocalRotation(filter->getTransform()->getLocalRotation());
-    m_PreviousTransforms.insert(std::make_pair(filter, previousTransform));
-    filter->getTransform()->translate(localDelta);
-  }
+  VTK_NEW(vtkTransform, delta);
+  delta->Translate(localDelta);
+  transformSelection(delta->GetMatrix());
 }
 
 // -----------------------------------------------------------------------------
@@ -843,32 +943,9 @@ void VSInteractorStyleFilterCamera::beginTranslation()
 {
   if(m_ActiveFilter && m_ActiveFilter->getTransform())
   {
-    m_InitialPosition = m_ActiveFilter->getTransform()->getLocalPosition();
-    for(int i = 0; i < 3; i++)
-    {
-      m_Translation[i] = 0.0;
-    }
-  }
-  m_PreviousTransforms.clear();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::cancelTranslation()
-{
-  for(int i = 0; i < 3; i++)
-  {
-    m_Translation[i] *= -1;
+    m_ActiveFilter->getTransform()->getLocalPosition(m_InitialPosition);
   }
-
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
-  for(VSAbstractFilter* filter : selection)
-  {
-    filter->getTransform()->translate(m_Translation);
-  }
-
-  m_ActionType = ActionType::None;
+  beginTransformOperation();
 }
 
 // -----------------------------------------------------------------------------
@@ -878,7 +955,6 @@ void VSInteractorStyleFilterCamera::rotateFilter()
 {
   if(nullptr == m_ActiveFilter || nullptr == m_ActiveProp)
   {
-    m_PreviousTransforms.clear();
     return;
   }
 
@@ -894,7 +970,6 @@ void VSInteractorStyleFilterCamera::rotateFilter()
 
   const double ROTATION_SPEED = 8.0;
   double rotateAmt = (currentDelta[0] + currentDelta[1]) / ROTATION_SPEED;
-  m_RotationAmt += rotateAmt;
 
   double rotationAxis[3] = {};
   rotationAxis[0] = m_CameraAxis[0];
@@ -930,16 +1005,9 @@ void VSInteractorStyleFilterCamera::rotateFilter()
   }
 
   // Rotate all selected filters
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
-  for(VSAbstractFilter* filter : selection)
-  {
-    VSTransform* previousTransform = new VSTransform(*filter->getTransform());
-    previousTransform->setLocalPosition(filter->getTransform()->getLocalPosition());
-    previousTransform->setLocalScale(filter->getTransform()->getLocalScale());
-    previousTransform->setLocalRotation(filter->getTransform()->getLocalRotation());
-    m_PreviousTransforms.insert(std::make_pair(filter, previousTransform));
-    filter->getTransform()->rotate(rotateAmt, rotationAxis);
-  }
+  VTK_NEW(vtkTransform, delta);
+  delta->RotateWXYZ(rotateAmt, rotationAxis);
+  transformSelection(delta->GetMatrix());
 }
 
 // -----------------------------------------------------------------------------
@@ -947,7 +1015,7 @@ void VSInteractorStyleFilterCamera::rotateFilter()
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::beginRotation()
 {
-  m_PreviousTransforms.clear();
+  beginTransformOperation();
   if(nullptr == m_ActiveFilter || nullptr == m_ActiveProp)
   {
     return;
@@ -958,19 +1026,6 @@ void VSInteractorStyleFilterCamera::beginRotation()
     vtkRenderWindowInteractor* iren = this->Interactor;
     m_InitialMousePos = iren->GetEventPosition();
     m_CameraAxis = GetDefaultRenderer()->GetActiveCamera()->GetDirectionOfProjection();
-    m_RotationAmt = 0.0;
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::cancelRotation()
-{
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
-  for(VSAbstractFilter* filter : selection)
-  {
-    filter->getTransform()->rotate(-1 * m_RotationAmt, m_CameraAxis);
   }
 }
 
@@ -981,7 +1036,6 @@ void VSInteractorStyleFilterCamera::scaleFilter()
 {
   if(nullptr == m_ActiveFilter || nullptr == m_ActiveProp)
   {
-    m_PreviousTransforms.clear();
     return;
   }
 
@@ -1000,7 +1054,6 @@ void VSInteractorStyleFilterCamera::scaleFilter()
   double percentChanged = currentDistance / m_LastDistance;
   m_LastDistance = currentDistance;
   double deltaScale = percentChanged;
-  m_ScaleAmt *= deltaScale;
 
   // Check for custom transform
   if(m_CustomTransform)
@@ -1038,16 +1091,9 @@ void VSInteractorStyleFilterCamera::scaleFilter()
   }
 
   // Scale all selected filters
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
-  for(VSAbstractFilter* filter : selection)
-  {
-    VSTransform* previousTransform = new VSTransform(*filter->getTransform());
-    previousTransform->setLocalPosition(filter->getTransform()->getLocalPosition());
-    previousTransform->setLocalScale(filter->getTransform()->getLocalScale());
-    previousTransform->setLocalRotation(filter->getTransform()->getLocalRotation());
-    m_PreviousTransforms.insert(std::make_pair(filter, previousTransform));
-    filter->getTransform()->scale(scaleVector);
-  }
+  VTK_NEW(vtkTransform, delta);
+  delta->Scale(scaleVector);
+  transformSelection(delta->GetMatrix());
 }
 
 // -----------------------------------------------------------------------------
@@ -1055,7 +1101,7 @@ void VSInteractorStyleFilterCamera::scaleFilter()
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::beginScaling()
 {
-  m_PreviousTransforms.clear();
+  beginTransformOperation();
   if(nullptr == m_ActiveFilter || nullptr == m_ActiveProp)
   {
     return;
@@ -1064,9 +1110,9 @@ void VSInteractorStyleFilterCamera::beginScaling()
   if(m_ActiveFilter)
   {
     vtkRenderWindowInteractor* iren = this->Interactor;
-    double* obj_center = m_ActiveFilter->getTransform()->getPosition();
+    m_ActiveFilter->getTransform()->getPosition(m_InitialCenter);
     double disp_obj_center[3];
-    this->ComputeWorldToDisplay(obj_center[0], obj_center[1], obj_center[2], disp_obj_center);
+    this->ComputeWorldToDisplay(m_InitialCenter[0], m_InitialCenter[1], m_InitialCenter[2], disp_obj_center);
 
     int* currentMousePos = iren->GetEventPosition();
     double currentDelta[2];
@@ -1075,98 +1121,186 @@ void VSInteractorStyleFilterCamera::beginScaling()
       currentDelta[i] = currentMousePos[i] - disp_obj_center[i];
     }
 
-    m_InitialCenter = m_ActiveFilter->getTransform()->getPosition();
     m_LastDistance = sqrt((currentDelta[0] * currentDelta[0]) + (currentDelta[1] * currentDelta[1]));
-    m_ScaleAmt = 1.0;
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::cancelScaling()
+void VSInteractorStyleFilterCamera::resetTransform()
 {
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
-  for(VSAbstractFilter* filter : selection)
+  beginTransformOperation();
+
+  m_ViewWidget->beginRenderBatch();
+  for(const TransformRecord& record : m_PendingOperation)
   {
-    filter->getTransform()->scale(1.0 / m_ScaleAmt);
+    VSFilterViewSettings* viewSettings = m_ViewWidget->getFilterViewSettings(record.m_Filter);
+    if(viewSettings && viewSettings->getDefaultTransform())
+    {
+      record.m_Filter->getTransform()->setLocalValues(viewSettings->getDefaultTransform());
+    }
   }
+  m_ViewWidget->endRenderBatch();
+
+  commitTransformOperation();
+  setActionType(ActionType::None);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::resetTransform()
+void VSInteractorStyleFilterCamera::undoTransform()
+{
+  // Finish any action in progress so that it can be undone as well
+  if(ActionType::None != m_ActionType)
+  {
+    setActionType(ActionType::None);
+  }
+  if(m_UndoOperations.empty())
+  {
+    return;
+  }
+
+  TransformOperation operation = std::move(m_UndoOperations.back());
+  m_UndoOperations.pop_back();
+
+  restoreTransforms(operation, false);
+  m_RedoOperations.push_back(std::move(operation));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::redoTransform()
+{
+  if(ActionType::None != m_ActionType)
+  {
+    setActionType(ActionType::None);
+  }
+  if(m_RedoOperations.empty())
+  {
+    return;
+  }
+
+  TransformOperation operation = std::move(m_RedoOperations.back());
+  m_RedoOperations.pop_back();
+
+  restoreTransforms(operation, true);
+  m_UndoOperations.push_back(std::move(operation));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::beginTransformOperation()
 {
+  m_PendingOperation.clear();
+
   VSAbstractFilter::FilterListType selection = getFilterSelection();
+  m_PendingOperation.reserve(selection.size());
 
+  VTK_NEW(vtkMatrix4x4, matrix);
   for(VSAbstractFilter* filter : selection)
   {
-    VSTransform* defaultTransform = m_ViewWidget->getFilterViewSettings(filter)->getDefaultTransform();
-    filter->getTransform()->setLocalPosition(defaultTransform->getLocalPosition());
-    filter->getTransform()->setLocalScale(defaultTransform->getLocalScale());
-    filter->getTransform()->setLocalRotation(defaultTransform->getLocalRotation());
+    if(nullptr == filter || nullptr == filter->getTransform())
+    {
+      continue;
+    }
+
+    TransformRecord record;
+    record.m_Filter = filter;
+    filter->getTransform()->getLocalMatrix(matrix);
+    vtkMatrix4x4::DeepCopy(record.m_Before.data(), matrix);
+    record.m_After = record.m_Before;
+    m_PendingOperation.push_back(record);
   }
-  setActionType(ActionType::None);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::undoTransform()
+void VSInteractorStyleFilterCamera::transformSelection(vtkMatrix4x4* delta)
 {
-  if(m_PreviousTransforms.empty())
+  // Every filter is updated before the view renders once
+  m_ViewWidget->beginRenderBatch();
+  for(const TransformRecord& record : m_PendingOperation)
+  {
+    if(record.m_Filter)
+    {
+      record.m_Filter->getTransform()->concatenate(delta);
+    }
+  }
+  m_ViewWidget->endRenderBatch();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::commitTransformOperation()
+{
+  if(m_PendingOperation.empty())
   {
     return;
   }
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
 
-  for(VSAbstractFilter* filter : selection)
+  VTK_NEW(vtkMatrix4x4, matrix);
+  for(TransformRecord& record : m_PendingOperation)
   {
-    VSTransform* previousTransform = m_PreviousTransforms.at(filter);
-    if(previousTransform != nullptr)
+    if(record.m_Filter)
     {
-      VSTransform* lastUndoneTransform = new VSTransform(filter->getTransform());
-      lastUndoneTransform->setLocalPosition(filter->getTransform()->getLocalPosition());
-      lastUndoneTransform->setLocalScale(filter->getTransform()->getLocalScale());
-      lastUndoneTransform->setLocalRotation(filter->getTransform()->getLocalRotation());
-      m_LastUndoneTransforms.insert(std::make_pair(filter, lastUndoneTransform));
-      filter->getTransform()->setLocalPosition(previousTransform->getLocalPosition());
-      filter->getTransform()->setLocalScale(previousTransform->getLocalScale());
-      filter->getTransform()->setLocalRotation(previousTransform->getLocalRotation());
+      record.m_Filter->getTransform()->getLocalMatrix(matrix);
+      vtkMatrix4x4::DeepCopy(record.m_After.data(), matrix);
     }
   }
-  setActionType(ActionType::None);
+
+  // Only filters that actually moved are kept in the history
+  auto unchanged = [](const TransformRecord& record) { return record.m_Filter.isNull() || record.m_Before == record.m_After; };
+  m_PendingOperation.erase(std::remove_if(m_PendingOperation.begin(), m_PendingOperation.end(), unchanged), m_PendingOperation.end());
+
+  if(!m_PendingOperation.empty())
+  {
+    m_UndoOperations.push_back(std::move(m_PendingOperation));
+    if(m_UndoOperations.size() > s_MaxUndoOperations)
+    {
+      m_UndoOperations.pop_front();
+    }
+    m_RedoOperations.clear();
+  }
+
+  m_PendingOperation.clear();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSInteractorStyleFilterCamera::redoTransform()
+void VSInteractorStyleFilterCamera::revertTransformOperation()
+{
+  restoreTransforms(m_PendingOperation, false);
+  m_PendingOperation.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::restoreTransforms(const TransformOperation& operation, bool after)
 {
-  if(m_LastUndoneTransforms.empty())
+  if(operation.empty())
   {
     return;
   }
-  VSAbstractFilter::FilterListType selection = getFilterSelection();
 
-  for(VSAbstractFilter* filter : selection)
+  VTK_NEW(vtkMatrix4x4, matrix);
+  m_ViewWidget->beginRenderBatch();
+  for(const TransformRecord& record : operation)
   {
-    VSTransform* lastUndoneTransform = m_LastUndoneTransforms.at(filter);
-    if(lastUndoneTransform != nullptr)
+    if(record.m_Filter)
     {
-      // Save the lastUndoneTransform as previousTransform
-      VSTransform* previousTransform = new VSTransform(*lastUndoneTransform);
-      previousTransform->setLocalPosition(lastUndoneTransform->getLocalPosition());
-      previousTransform->setLocalScale(lastUndoneTransform->getLocalScale());
-      previousTransform->setLocalRotation(lastUndoneTransform->getLocalRotation());
-      m_PreviousTransforms.insert(std::make_pair(filter, previousTransform));
-      filter->getTransform()->setLocalPosition(lastUndoneTransform->getLocalPosition());
-      filter->getTransform()->setLocalScale(lastUndoneTransform->getLocalScale());
-      filter->getTransform()->setLocalRotation(lastUndoneTransform->getLocalRotation());
+      matrix->DeepCopy(after ? record.m_After.data() : record.m_Before.data());
+      record.m_Filter->getTransform()->setLocalMatrix(matrix);
     }
   }
-  setActionType(ActionType::None);
+  m_ViewWidget->endRenderBatch();
 }
 
 // -----------------------------------------------------------------------------
@@ -1326,71 +1460,23 @@ void VSInteractorStyleFilterCamera::updateTransformText()
 // -----------------------------------------------------------------------------
 void VSInteractorStyleFilterCamera::determineSubsampling()
 {
-  VTK_PTR(vtkCamera) camera = m_ViewWidget->getVisualizationWidget()->getRenderer()->GetActiveCamera();
-  double cameraPosition[3];
-  if(camera)
+  vtkRenderer* renderer = m_ViewWidget->getVisualizationWidget()->getRenderer();
+  if(nullptr == renderer)
   {
-    camera->GetPosition(cameraPosition);
+    return;
   }
 
-  // Check the memory available vs memory required for current subsampling rate
-  std::map<VSAbstractFilter*, VSFilterViewSettings*> allFilterViewSettings = m_ViewWidget->getAllFilterViewSettings();
-  bool isSIMPL = false;
-  VSSIMPLDataContainerFilter* simplDataContainerFilter;
-  VSDataSetFilter* imageDatasetFilter;
-  VSFilterViewSettings::Collection filterViewSettingsCollection;
-  double distanceToPlane;
+  // Each flat SIMPL image picks its own level from its projected size on screen
+  VSFilterViewSettings::Map allFilterViewSettings = m_ViewWidget->getAllFilterViewSettings();
   for(auto iter = allFilterViewSettings.begin(); iter != allFilterViewSettings.end(); iter++)
   {
-    filterViewSettingsCollection.push_back(iter->second);
-    if(!isSIMPL)
+    VSFilterViewSettings* settings = iter->second;
+    VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(iter->first);
+    if(nullptr == dcFilter || !dcFilter->isDataResident() || !settings->isVisible() || !settings->isFlat())
     {
-      try
-      {
-        simplDataContainerFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(iter->first);
-        imageDatasetFilter = dynamic_cast<VSDataSetFilter*>(iter->first);
-      } catch(const std::bad_cast& badCastException)
-      {
-        qDebug() << badCastException.what();
-      }
-      isSIMPL = simplDataContainerFilter && iter->second->isFlat();
-      if(isSIMPL || imageDatasetFilter)
-      {
-        double position[3];
-        VTK_PTR(vtkProp3D) actor = iter->second->getActor();
-        if(actor)
-        {
-          actor->GetPosition(position);
-        }
-        VTK_PTR(vtkPlane) plane = VTK_PTR(vtkPlane)::New();
-        if(plane)
-        {
-          plane->SetOrigin(position);
-
-          // Check distance to plane from camera
-          distanceToPlane = plane->DistanceToPlane(cameraPosition);
-        }
-      }
-    }
-  }
-
-  // Only works if this is a VSSIMPLDataContainerFilter
-  if(isSIMPL)
-  {
-    int subsamplingRate = 1;
-
-    if(distanceToPlane > 10.0)
-    {
-      subsamplingRate = (distanceToPlane) / 1000;
-      if(subsamplingRate > 100)
-      {
-        subsamplingRate = 100;
-      }
+      continue;
     }
 
-    if(subsamplingRate > 1)
-    {
-      VSFilterViewSettings::SetSubsampling(filterViewSettingsCollection, subsamplingRate);
-    }
+    settings->updateLevelOfDetail(renderer);
   }
 }
@@ -35,8 +35,17 @@
 
 #pragma once
 
+#include <array>
+#include <deque>
+#include <vector>
+
+#include <QtCore/QPointer>
+
+#include <vtkCellPicker.h>
 #include <vtkInteractorStyleImage.h>
+#include <vtkMatrix4x4.h>
 #include <vtkProp3D.h>
+#include <vtkSmartPointer.h>
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
@@ -104,7 +113,8 @@ public:
   void setViewWidget(VSAbstractViewWidget* viewWidget);
 
   /**
-   * @brief Returns the visualization filter and vtkProp3D rendered at the given screen coordinates
+   * @brief Returns the visualization filter and vtkProp3D rendered at the given screen coordinates.
+   * Candidates are found through the view's VSPickIndex and only those are picked against.
    * @param pos
    * @return
    */
@@ -223,11 +233,6 @@ protected:
    */
   void beginTranslation();
 
-  /**
-   * @brief Cancels a drag movement
-   */
-  void cancelTranslation();
-
   /**
    * @brief Rotates the selected filter based on the camera angle
    */
@@ -238,11 +243,6 @@ protected:
    */
   void beginRotation();
 
-  /**
-   * @brief Cancels the filter rotation
-   */
-  void cancelRotation();
-
   /**
    * @brief Scales the selected filter based on mouse movements
    */
@@ -253,11 +253,6 @@ protected:
    */
   void beginScaling();
 
-  /**
-   * @brief Resets the selected filter's scaling to the initial value.
-   */
-  void cancelScaling();
-
   /**
    * @brief Resets the transform of the selected filter
    */
@@ -273,6 +268,29 @@ protected:
    */
   void redoTransform();
 
+  /**
+   * @brief Records the local matrix of each selected filter so that the
+   * current action can be cancelled or undone
+   */
+  void beginTransformOperation();
+
+  /**
+   * @brief Concatenates the delta matrix onto every filter in the current
+   * operation and renders once after all of them have been updated
+   * @param delta
+   */
+  void transformSelection(vtkMatrix4x4* delta);
+
+  /**
+   * @brief Adds the current operation to the undo history if any filter changed
+   */
+  void commitTransformOperation();
+
+  /**
+   * @brief Restores the filters in the current operation to their initial matrices
+   */
+  void revertTransformOperation();
+
   /**
    * @brief Selects all the filters
    */
@@ -313,7 +331,7 @@ protected:
   void updateLinkedRenderWindows();
 
   /**
-   * @brief Determine the amount of subsampling to perform, if any
+   * @brief Updates the subsampling level of each visible flat SIMPL image based on its size on screen
    */
   void determineSubsampling();
 
@@ -323,25 +341,40 @@ protected:
   void updateTransformText();
 
 private:
+  struct TransformRecord
+  {
+    QPointer<VSAbstractFilter> m_Filter;
+    std::array<double, 16> m_Before;
+    std::array<double, 16> m_After;
+  };
+  using TransformOperation = std::vector<TransformRecord>;
+
+  /**
+   * @brief Sets each filter in the operation to its initial or final local matrix
+   * @param operation
+   * @param after
+   */
+  void restoreTransforms(const TransformOperation& operation, bool after);
+
   VSAbstractFilter* m_ActiveFilter = nullptr;
   vtkProp3D* m_ActiveProp = nullptr;
   ActionType m_ActionType = ActionType::None;
   Axis m_ActionAxis = Axis::None;
   bool m_CustomTransform = false;
   QString m_CustomTransformAmount;
-  std::map<VSAbstractFilter*, VSTransform*> m_PreviousTransforms;
-  std::map<VSAbstractFilter*, VSTransform*> m_LastUndoneTransforms;
+  // Undo history
+  TransformOperation m_PendingOperation;
+  std::deque<TransformOperation> m_UndoOperations;
+  std::deque<TransformOperation> m_RedoOperations;
   // Position
-  double* m_InitialPosition;
-  double m_Translation[3];
+  double m_InitialPosition[3];
   // Rotation
   int* m_InitialMousePos;
   double* m_CameraAxis;
-  double m_RotationAmt;
   // Scaling
-  double* m_InitialCenter;
+  double m_InitialCenter[3];
   double m_LastDistance;
-  double m_ScaleAmt = 1.0;
 
   VSAbstractViewWidget* m_ViewWidget = nullptr;
+  vtkSmartPointer<vtkCellPicker> m_Picker = nullptr;
 };
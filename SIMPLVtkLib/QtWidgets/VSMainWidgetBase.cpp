@@ -71,6 +71,20 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdFilter.h"
 #include "SIMPLVtkLib/Wizards/ExecutePipeline/ExecutePipelineConstants.h"
 
+namespace
+{
+using DataContainerReload = std::pair<VSSIMPLDataContainerFilter*, DataContainer::Pointer>;
+
+/**
+ * @brief Wraps a DataContainer read during a batched reload for its filter
+ * @param reload
+ */
+void wrapReloadedDataContainer(DataContainerReload& reload)
+{
+  reload.first->reloadData(reload.second);
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -90,7 +104,6 @@ void VSMainWidgetBase::connectSlots()
   // Signals from VSController should be on the main thread, so Qt5 connections should be safe
   connect(m_Controller, &VSController::filterAdded, this, &VSMainWidgetBase::filterAdded);
   connect(m_Controller, &VSController::filterRemoved, this, &VSMainWidgetBase::filterRemoved);
-  connect(m_Controller, &VSController::blockRender, this, &VSMainWidgetBase::setBlockRender);
   connect(m_Controller, &VSController::importDataQueueStarted, this, &VSMainWidgetBase::importDataQueueStarted);
   connect(m_Controller, &VSController::importDataQueueFinished, this, &VSMainWidgetBase::importDataQueueFinished);
 }
@@ -497,6 +510,39 @@ void VSMainWidgetBase::launchHDF5SelectionDialog(const QString& filePath)
       connect(&reader, SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SLOT(generateError(const QString&, const QString&, const int&)));
 
       DataContainerArrayProxy dcaProxy = dialog->getDataStructureProxy();
+      VSAbstractViewWidget* activeViewWidget = getActiveViewWidget();
+      if(activeViewWidget && activeViewWidget->isStreamingTiles())
+      {
+        // Read only the structure so that flat images can be imported without their arrays
+        DataContainerArray::Pointer evictedDca = reader.readSIMPLDataUsingProxy(dcaProxy, true);
+        if(evictedDca.get() == nullptr)
+        {
+          return;
+        }
+
+        QMap<QString, DataContainerProxy>& dataContainers = dcaProxy.getDataContainers();
+        DataContainerArray::Container structure = evictedDca->getDataContainers();
+        for(const DataContainer::Pointer& dc : structure)
+        {
+          if(VSSIMPLDataContainerFilter::IsFlatImage(dc))
+          {
+            dataContainers.remove(dc->getName());
+          }
+          else
+          {
+            evictedDca->removeDataContainer(dc->getName());
+          }
+        }
+
+        DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(dcaProxy, false);
+        if(dca.get() == nullptr)
+        {
+          return;
+        }
+        m_Controller->importDataContainerArray(filePath, dca, evictedDca);
+        return;
+      }
+
       DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(dcaProxy, false);
       if(dca.get() == nullptr)
       {
@@ -848,13 +894,15 @@ void VSMainWidgetBase::reloadFilters(std::vector<VSAbstractDataFilter*> filters)
 {
   if(filters.size() == 1)
   {
-    // This is a single filter, so do a simple reload
+    // This is a single filter, so do a simple reload.  Filters update their watchers and
+    // display text while reloading, so the reload is started on the filter's thread.
     VSAbstractDataFilter* filter = filters[0];
-    filter->reloadData();
+    QMetaObject::invokeMethod(filter, "reloadData", Qt::QueuedConnection);
   }
   else if(filters.size() > 1 && dynamic_cast<VSSIMPLDataContainerFilter*>(filters[0]) != nullptr)
   {
-    // This is from a file containing multiple SIMPL Data Containers, so we will use this block of code to optimize the file reading process
+    // This is from a file containing multiple SIMPL Data Containers.  The file is opened and its
+    // structure read once, every container is read in a single pass, and then wrapped in parallel.
     QSharedPointer<SIMPLH5DataReader> reader = QSharedPointer<SIMPLH5DataReader>(new SIMPLH5DataReader());
     connect(reader.data(), SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SLOT(generateError(const QString&, const QString&, const int&)));
 
@@ -864,6 +912,7 @@ void VSMainWidgetBase::reloadFilters(std::vector<VSAbstractDataFilter*> filters)
     {
       QString ss = QObject::tr("Data Container filters could not be reloaded because they do not have a file filter parent.");
       emit generateError("Data Reload Error", ss, -3002);
+      return;
     }
 
     bool success = reader->openFile(fileNameFilter->getFilePath());
@@ -874,25 +923,56 @@ void VSMainWidgetBase::reloadFilters(std::vector<VSAbstractDataFilter*> filters)
       DataContainerArrayProxy dcaProxy = reader->readDataContainerArrayStructure(&req, err);
       QMap<QString, DataContainerProxy>& dataContainers = dcaProxy.getDataContainers();
 
+      AttributeMatrixProxy::AMTypeFlags amFlags(AttributeMatrixProxy::AMTypeFlag::Cell_AMType);
+      DataArrayProxy::PrimitiveTypeFlags pFlags(DataArrayProxy::PrimitiveTypeFlag::Any_PType);
+      DataArrayProxy::CompDimsVector compDimsVector;
+
+      std::vector<VSSIMPLDataContainerFilter*> existingFilters;
       for(size_t i = 0; i < filters.size(); i++)
       {
         VSSIMPLDataContainerFilter* validFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(filters[i]);
+        if(nullptr == validFilter)
+        {
+          continue;
+        }
 
         if(dataContainers.contains(validFilter->getFilterName()))
         {
-          validFilter->reloadData();
+          DataContainerProxy dcProxy = dataContainers.value(validFilter->getFilterName());
+          dcProxy.setFlags(Qt::Checked, amFlags, pFlags, compDimsVector);
+          dataContainers[dcProxy.getName()] = dcProxy;
+          existingFilters.push_back(validFilter);
         }
         else
         {
           validFilter->removeFilter();
         }
-
-        DataContainerProxy dcProxy = dataContainers.value(validFilter->getFilterName());
-        dcProxy.setFlag(Qt::Unchecked);
-        dataContainers[dcProxy.getName()] = dcProxy;
       }
 
       DataContainerArray::Pointer dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+      if(nullptr == dca)
+      {
+        return;
+      }
+
+      // Hand the existing containers to their filters.  Anything left over is new to the file.
+      std::vector<DataContainerReload> reloads;
+      for(VSSIMPLDataContainerFilter* reloadFilter : existingFilters)
+      {
+        DataContainer::Pointer dc = dca->getDataContainer(reloadFilter->getFilterName());
+        if(dc)
+        {
+          reloads.push_back(DataContainerReload(reloadFilter, dc));
+          dca->removeDataContainer(dc->getName());
+        }
+      }
+
+      QtConcurrent::blockingMap(reloads, wrapReloadedDataContainer);
+      for(const DataContainerReload& reload : reloads)
+      {
+        QMetaObject::invokeMethod(reload.first, "reloadWrappingFinished", Qt::QueuedConnection);
+      }
+
       if(dca->getDataContainers().size() > 0)
       {
         m_Controller->importDataContainerArray(fileNameFilter, dca);
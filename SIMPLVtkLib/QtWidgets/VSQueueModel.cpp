@@ -98,6 +98,38 @@ void VSQueueModel::cancelQueue()
   m_ImportDataWorker->cancelWorker();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSQueueModel::setMaxConcurrentImports(int count)
+{
+  m_ImportDataWorker->setMaxConcurrentImports(count);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSQueueModel::getMaxConcurrentImports() const
+{
+  return m_ImportDataWorker->getMaxConcurrentImports();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSQueueModel::setImportMemoryBudget(size_t bytes)
+{
+  m_ImportDataWorker->setMemoryBudget(bytes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSQueueModel::getImportMemoryBudget() const
+{
+  return m_ImportDataWorker->getMemoryBudget();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -72,6 +72,20 @@ public:
   void startQueue();
   void cancelQueue();
 
+  /**
+   * @brief Sets the maximum number of importers that execute at the same time
+   * @param count
+   */
+  void setMaxConcurrentImports(int count);
+  int getMaxConcurrentImports() const;
+
+  /**
+   * @brief Sets the memory budget in bytes shared by executing importers.  0 disables the budget.
+   * @param bytes
+   */
+  void setImportMemoryBudget(size_t bytes);
+  size_t getImportMemoryBudget() const;
+
   void addImporter(const QString& name, VSAbstractImporter::Pointer importer, QIcon icon);
   void insertImporter(int row, const QString& name, VSAbstractImporter::Pointer importer, QIcon icon);
 
@@ -164,7 +164,8 @@ void VSTransformWidget::setTransform(VSTransform* transform)
     connect(transform, &VSTransform::updatedLocalScale, this, &VSTransformWidget::updateLocalScale);
 
     // local
-    double* localPos = transform->getLocalPosition();
+    double localPos[3];
+    transform->getLocalPosition(localPos);
     double* originPosition = transform->getOriginPosition();
     if(originPosition != nullptr)
     {
@@ -177,7 +178,8 @@ void VSTransformWidget::setTransform(VSTransform* transform)
     m_Internals->posYEdit->setText(QString::number(localPos[1]));
     m_Internals->posZEdit->setText(QString::number(localPos[2]));
 
-    double* localRot = transform->getLocalRotation();
+    double localRot[3];
+    transform->getLocalRotation(localRot);
     double* originRotation = transform->getOriginRotation();
     if(originRotation != nullptr)
     {
@@ -190,7 +192,8 @@ void VSTransformWidget::setTransform(VSTransform* transform)
     m_Internals->rotYEdit->setText(QString::number(localRot[1]));
     m_Internals->rotZEdit->setText(QString::number(localRot[2]));
 
-    double* localScale = transform->getLocalScale();
+    double localScale[3];
+    transform->getLocalScale(localScale);
     double* originScale = transform->getOriginScale();
     if(originScale != nullptr)
     {
@@ -304,7 +307,8 @@ void VSTransformWidget::rotationEditChanged(char axis)
   for(VSAbstractFilter* filter : m_SelectedFilters)
   {
     double* originRotation = filter->getTransform()->getOriginRotation();
-    double* localRotation = filter->getTransform()->getLocalRotation();
+    double localRotation[3];
+    filter->getTransform()->getLocalRotation(localRotation);
 
     switch(axis)
     {
@@ -348,7 +352,8 @@ void VSTransformWidget::scaleEditChanged(char axis)
   for(VSAbstractFilter* filter : m_SelectedFilters)
   {
     double* originScale = filter->getTransform()->getOriginScale();
-    double* localScale = filter->getTransform()->getLocalScale();
+    double localScale[3];
+    filter->getTransform()->getLocalScale(localScale);
 
     switch(axis)
     {
@@ -382,18 +387,10 @@ void VSTransformWidget::scaleEditChanged(char axis)
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateTranslationLabels()
 {
-  double* position;
-  if(nullptr == m_Transform)
-  {
-    position = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      position[i] = 0.0;
-    }
-  }
-  else
+  double position[3] = {0.0, 0.0, 0.0};
+  if(m_Transform)
   {
-    position = m_Transform->getPosition();
+    m_Transform->getPosition(position);
   }
 
   QLocale locale = QLocale::system();
@@ -412,18 +409,10 @@ void VSTransformWidget::updateTranslationLabels()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateRotationLabels()
 {
-  double* rotation;
-  if(nullptr == m_Transform)
-  {
-    rotation = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      rotation[i] = 0.0;
-    }
-  }
-  else
+  double rotation[3] = {0.0, 0.0, 0.0};
+  if(m_Transform)
   {
-    rotation = m_Transform->getRotation();
+    m_Transform->getRotation(rotation);
     double* originRotation = m_Transform->getOriginRotation();
     if(originRotation != nullptr)
     {
@@ -450,18 +439,10 @@ void VSTransformWidget::updateRotationLabels()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateScaleLabels()
 {
-  double* scale;
-  if(nullptr == m_Transform)
-  {
-    scale = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      scale[i] = 1.0;
-    }
-  }
-  else
+  double scale[3] = {1.0, 1.0, 1.0};
+  if(m_Transform)
   {
-    scale = m_Transform->getScale();
+    m_Transform->getScale(scale);
   }
 
   QLocale locale = QLocale::system();
@@ -480,19 +461,10 @@ void VSTransformWidget::updateScaleLabels()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateLocalTranslation()
 {
-  double* position;
-  double* origin;
-  if(nullptr == m_Transform)
-  {
-    position = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      position[i] = 0.0;
-    }
-  }
-  else
+  double position[3] = {0.0, 0.0, 0.0};
+  if(m_Transform)
   {
-    position = m_Transform->getLocalPosition();
+    m_Transform->getLocalPosition(position);
     double* origin = m_Transform->getOriginPosition();
     for(int i = 0; i < 3; i++)
     {
@@ -510,18 +482,10 @@ void VSTransformWidget::updateLocalTranslation()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateLocalRotation()
 {
-  double* rotation;
-  if(nullptr == m_Transform)
-  {
-    rotation = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      rotation[i] = 0.0;
-    }
-  }
-  else
+  double rotation[3] = {0.0, 0.0, 0.0};
+  if(m_Transform)
   {
-    rotation = m_Transform->getLocalRotation();
+    m_Transform->getLocalRotation(rotation);
   }
 
   m_Internals->rotXEdit->setText(QString::number(rotation[0]));
@@ -534,18 +498,10 @@ void VSTransformWidget::updateLocalRotation()
 // -----------------------------------------------------------------------------
 void VSTransformWidget::updateLocalScale()
 {
-  double* scale;
-  if(nullptr == m_Transform)
-  {
-    scale = new double[3];
-    for(int i = 0; i < 3; i++)
-    {
-      scale[i] = 0.0;
-    }
-  }
-  else
+  double scale[3] = {0.0, 0.0, 0.0};
+  if(m_Transform)
   {
-    scale = m_Transform->getLocalScale();
+    m_Transform->getLocalScale(scale);
     double* originScale = m_Transform->getOriginScale();
     if(originScale != nullptr)
     {
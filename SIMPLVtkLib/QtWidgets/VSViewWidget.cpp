@@ -239,6 +239,7 @@ QMenu* VSViewWidget::getContextMenu(VSAbstractFilter* filter)
   }
 
   menu->addAction(getVisualizationWidget()->getLinkCamerasAction());
+  menu->addAction(getStreamTilesAction());
 
   return menu;
 }
@@ -319,6 +320,7 @@ void VSViewWidget::showVisualizationContextMenu(const QPoint& point)
   }
 
   menu.addAction(getVisualizationWidget()->getLinkCamerasAction());
+  menu.addAction(getStreamTilesAction());
 
   menu.exec(getVisualizationWidget()->mapToGlobal(point));
 }
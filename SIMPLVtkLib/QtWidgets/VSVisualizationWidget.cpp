@@ -58,7 +58,6 @@ VTK_MODULE_INIT(vtkInteractionStyle)
 #include <vtkOrientationMarkerWidget.h>
 #include <vtkPNGWriter.h>
 #include <vtkPointPicker.h>
-#include <vtkPropPicker.h>
 #include <vtkProperty.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
@@ -201,6 +200,9 @@ void VSVisualizationWidget::clearRenderWindow()
 // -----------------------------------------------------------------------------
 void VSVisualizationWidget::saveScreenshot(QString fileName)
 {
+  // Render any pending changes before reading the frame buffer
+  render();
+
   VTK_NEW(vtkWindowToImageFilter, screenshotFilter);
   screenshotFilter->SetInput(m_Renderer->GetRenderWindow());
   screenshotFilter->SetInputBufferTypeToRGBA();
@@ -611,6 +613,5 @@ VSAbstractFilter* VSVisualizationWidget::getFilterFromScreenCoords(int pos[2])
   VSAbstractFilter* filter = nullptr;
   std::tie(prop, filter) = style->getFilterFromScreenCoords(pos);
 
-  render();
   return filter;
 }
@@ -41,6 +41,9 @@
 
 #include "SIMPLVtkBridge.h"
 
+#include <type_traits>
+
+#include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkCellDataToPointData.h>
 #include <vtkCharArray.h>
@@ -48,6 +51,7 @@
 #include <vtkDataArray.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkImageData.h>
 #include <vtkIntArray.h>
 #include <vtkLine.h>
@@ -56,15 +60,19 @@
 #include <vtkMappedUnstructuredGrid.h>
 #include <vtkNamedColors.h>
 #include <vtkPointData.h>
+#include <vtkPointSet.h>
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkPolygon.h>
 #include <vtkRectilinearGrid.h>
 #include <vtkScalarBarActor.h>
+#include <vtkSMPTools.h>
 #include <vtkScalarBarWidget.h>
 #include <vtkShortArray.h>
 #include <vtkStructuredPoints.h>
 #include <vtkTextProperty.h>
+#include <vtkTypeInt32Array.h>
+#include <vtkTypeInt64Array.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedIntArray.h>
 #include <vtkUnsignedLongLongArray.h>
@@ -72,6 +80,7 @@
 #include <vtkUnstructuredGrid.h>
 #include <vtkVertexGlyphFilter.h>
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSQuadGeom.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h"
@@ -87,6 +96,224 @@ namespace
 {
 const AttributeMatrix::Types CellTypes = {AttributeMatrix::Type::Cell, AttributeMatrix::Type::Face, AttributeMatrix::Type::Edge};
 const AttributeMatrix::Types PointTypes = {AttributeMatrix::Type::Vertex};
+
+// Views request point arrays through VSAbstractFilter::getPointDataArray when they need them
+SIMPLVtkBridge::PointDataMode s_PointDataMode = SIMPLVtkBridge::PointDataMode::Lazy;
+SIMPLVtkBridge::GeometryMode s_GeometryMode = SIMPLVtkBridge::GeometryMode::Mapped;
+
+size_t ArrayByteSize(vtkDataArray* array)
+{
+  if(nullptr == array)
+  {
+    return 0;
+  }
+
+  return static_cast<size_t>(array->GetNumberOfValues()) * static_cast<size_t>(array->GetDataTypeSize());
+}
+
+#if VTK_MAJOR_VERSION >= 9
+template <typename ArrayType>
+VTK_PTR(ArrayType) CreateOffsets(vtkIdType numCells, vtkIdType cellSize)
+{
+  VTK_NEW(ArrayType, offsets);
+  offsets->SetNumberOfValues(numCells + 1);
+  auto* offsetValues = offsets->GetPointer(0);
+  vtkSMPTools::For(0, numCells + 1, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      offsetValues[i] = i * cellSize;
+    }
+  });
+
+  return offsets;
+}
+#endif
+
+/**
+ * @brief Creates a vtkCellArray from a SIMPLib connectivity list with a fixed number of
+ * vertices per cell.  When vtkCellArray stores offsets and connectivity separately and the
+ * SIMPLib index width matches one of its storage types, the SIMPLib buffer is referenced
+ * directly.  Otherwise the list is converted in one parallel pass.
+ */
+template <typename ListPointer>
+VTK_PTR(vtkCellArray) WrapCellList(const ListPointer& list)
+{
+  using IndexType = typename std::decay<decltype(*list->getPointer(0))>::type;
+
+  const vtkIdType numCells = static_cast<vtkIdType>(list->getNumberOfTuples());
+  const vtkIdType cellSize = static_cast<vtkIdType>(list->getNumberOfComponents());
+  IndexType* ids = list->getPointer(0);
+
+  VTK_NEW(vtkCellArray, cells);
+#if VTK_MAJOR_VERSION >= 9
+  if(sizeof(IndexType) == sizeof(vtkTypeInt64))
+  {
+    VTK_NEW(vtkTypeInt64Array, connectivity);
+    connectivity->SetVoidArray(ids, numCells * cellSize, 1);
+    cells->SetData(CreateOffsets<vtkTypeInt64Array>(numCells, cellSize), connectivity);
+    return cells;
+  }
+  if(sizeof(IndexType) == sizeof(vtkTypeInt32) && numCells * cellSize <= VTK_TYPE_INT32_MAX)
+  {
+    VTK_NEW(vtkTypeInt32Array, connectivity);
+    connectivity->SetVoidArray(ids, numCells * cellSize, 1);
+    cells->SetData(CreateOffsets<vtkTypeInt32Array>(numCells, cellSize), connectivity);
+    return cells;
+  }
+
+  VTK_NEW(vtkIdTypeArray, connectivity);
+  connectivity->SetNumberOfValues(numCells * cellSize);
+  vtkIdType* connectivityValues = connectivity->GetPointer(0);
+  vtkSMPTools::For(0, numCells * cellSize, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      connectivityValues[i] = static_cast<vtkIdType>(ids[i]);
+    }
+  });
+  cells->SetData(CreateOffsets<vtkIdTypeArray>(numCells, cellSize), connectivity);
+#else
+  // The legacy layout prefixes every cell with its size and cannot reference the SIMPLib buffer
+  VTK_NEW(vtkIdTypeArray, legacyIds);
+  legacyIds->SetNumberOfValues(numCells * (cellSize + 1));
+  vtkIdType* legacyValues = legacyIds->GetPointer(0);
+  vtkSMPTools::For(0, numCells, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      vtkIdType* cell = legacyValues + cellId * (cellSize + 1);
+      const IndexType* cellIds = ids + cellId * cellSize;
+      cell[0] = cellSize;
+      for(vtkIdType i = 0; i < cellSize; i++)
+      {
+        cell[i + 1] = static_cast<vtkIdType>(cellIds[i]);
+      }
+    }
+  });
+  cells->SetCells(numCells, legacyIds);
+#endif
+
+  return cells;
+}
+
+/**
+ * @brief Creates a vtkCellArray with one vertex cell per point
+ */
+VTK_PTR(vtkCellArray) CreateVertexCells(vtkIdType numPoints)
+{
+  VTK_NEW(vtkCellArray, cells);
+#if VTK_MAJOR_VERSION >= 9
+  VTK_NEW(vtkIdTypeArray, connectivity);
+  connectivity->SetNumberOfValues(numPoints);
+  vtkIdType* connectivityValues = connectivity->GetPointer(0);
+  vtkSMPTools::For(0, numPoints, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      connectivityValues[i] = i;
+    }
+  });
+  cells->SetData(CreateOffsets<vtkIdTypeArray>(numPoints, 1), connectivity);
+#else
+  VTK_NEW(vtkIdTypeArray, legacyIds);
+  legacyIds->SetNumberOfValues(2 * numPoints);
+  vtkIdType* legacyValues = legacyIds->GetPointer(0);
+  vtkSMPTools::For(0, numPoints, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      legacyValues[2 * i] = 1;
+      legacyValues[2 * i + 1] = i;
+    }
+  });
+  cells->SetCells(numPoints, legacyIds);
+#endif
+
+  return cells;
+}
+
+VTK_PTR(vtkPoints) WrapPoints(const SharedVertexList::Pointer& vertexArray)
+{
+  VTK_NEW(vtkPoints, points);
+  points->SetDataTypeToFloat();
+  points->SetData(SIMPLVtkBridge::WrapVertices(vertexArray));
+  return points;
+}
+
+/**
+ * @brief Adds the memory used by a native cell array to the report.  Connectivity that
+ * references the SIMPLib buffer is counted as shared.
+ */
+void AddCellArrayBytes(vtkCellArray* cells, SIMPLVtkBridge::MemoryReport& report)
+{
+  if(nullptr == cells)
+  {
+    return;
+  }
+
+#if VTK_MAJOR_VERSION >= 9
+  // WrapCellList only uses the fixed width array types when referencing SIMPLib buffers
+  vtkDataArray* connectivity = cells->GetConnectivityArray();
+  if(nullptr != connectivity && (connectivity->IsA("vtkTypeInt64Array") || connectivity->IsA("vtkTypeInt32Array")))
+  {
+    report.m_SharedBytes += ArrayByteSize(connectivity);
+  }
+  else
+  {
+    report.m_CopiedBytes += ArrayByteSize(connectivity);
+  }
+  report.m_CopiedBytes += ArrayByteSize(cells->GetOffsetsArray());
+#else
+  report.m_CopiedBytes += ArrayByteSize(cells->GetData());
+#endif
+}
+
+/**
+ * @brief Returns the mapped geometry implementation if the vtkDataSet is a GridType.
+ * Returns nullptr otherwise.
+ */
+template <typename GridType>
+auto GetMappedImplementation(vtkDataSet* dataSet) -> decltype(GridType::SafeDownCast(dataSet)->GetImplementation())
+{
+  GridType* grid = GridType::SafeDownCast(dataSet);
+  if(nullptr == grid)
+  {
+    return nullptr;
+  }
+
+  return grid->GetImplementation();
+}
+
+/**
+ * @brief Calls func with the mapped geometry implementation used by the vtkDataSet.
+ * Returns false if the vtkDataSet is not a mapped SIMPLib geometry.
+ */
+template <typename FuncType>
+bool VisitMappedImplementation(vtkDataSet* dataSet, FuncType func)
+{
+  if(auto edgeImpl = GetMappedImplementation<VSEdgeGrid>(dataSet))
+  {
+    func(edgeImpl);
+  }
+  else if(auto quadImpl = GetMappedImplementation<VSQuadGrid>(dataSet))
+  {
+    func(quadImpl);
+  }
+  else if(auto tetImpl = GetMappedImplementation<VSTetrahedralGrid>(dataSet))
+  {
+    func(tetImpl);
+  }
+  else if(auto triImpl = GetMappedImplementation<VtkTriangleGrid>(dataSet))
+  {
+    func(triImpl);
+  }
+  else if(auto vertImpl = GetMappedImplementation<VSVertexGrid>(dataSet))
+  {
+    func(vertImpl);
+  }
+  else
+  {
+    return false;
+  }
+
+  return true;
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -165,39 +392,14 @@ SIMPLVtkBridge::WrappedDataContainerPtr SIMPLVtkBridge::WrapDataContainerAsStruc
         cellData->AddArray(wrappedCellData->m_VtkArray);
       }
 
-      // Create point data from cell data
-      VTK_NEW(vtkCellDataToPointData, cell2Point);
-      cell2Point->SetInputData(dataSet);
-      cell2Point->PassCellDataOn();
-      cell2Point->Update();
-
-      VTK_PTR(vtkDataSet) pointDataSet = nullptr;
-      switch(dataSet->GetDataObjectType())
+      // Point data is interpolated per array so the wrapped cell data remains shared with SIMPLib
+      if(PointDataMode::Eager == GetPointDataMode())
       {
-      case VTK_IMAGE_DATA:
-        pointDataSet = cell2Point->GetImageDataOutput();
-        break;
-      case VTK_STRUCTURED_GRID:
-        pointDataSet = cell2Point->GetUnstructuredGridOutput();
-        break;
-      case VTK_RECTILINEAR_GRID:
-        pointDataSet = cell2Point->GetRectilinearGridOutput();
-        break;
-      case VTK_STRUCTURED_POINTS:
-        pointDataSet = cell2Point->GetStructuredPointsOutput();
-        break;
-      case VTK_UNSTRUCTURED_GRID:
-        pointDataSet = cell2Point->GetUnstructuredGridOutput();
-        break;
-      case VTK_POLY_DATA:
-        pointDataSet = cell2Point->GetPolyDataOutput();
-        break;
-      default:
-        pointDataSet = cell2Point->GetOutput();
-        break;
+        for(const WrappedDataArrayPtr& wrappedCellData : wrappedDcStruct->m_CellData)
+        {
+          RequestPointDataArray(wrappedDcStruct, wrappedCellData->m_ArrayName);
+        }
       }
-
-      dataSet->DeepCopy(pointDataSet);
     }
     // Wrap Vertex data
     else if(AttributeMatrix::Type::Vertex == attrMat->getType())
@@ -454,6 +656,7 @@ void SIMPLVtkBridge::FinishWrappingDataContainerStruct(const WrappedDataContaine
   }
 
   VTK_PTR(vtkDataSet) dataSet = wrappedDcStruct->m_DataSet;
+  ReleasePointDataArrays(wrappedDcStruct);
   wrappedDcStruct->m_CellData.clear();
   wrappedDcStruct->m_PointData.clear();
   DataContainer::Container_t amMap = wrappedDcStruct->m_DataContainer->getAttributeMatrices();
@@ -514,6 +717,19 @@ void SIMPLVtkBridge::FinishWrappingDataContainerStruct(const WrappedDataContaine
     }
   }
   cellData->Update();
+
+  // Point data released above is interpolated again from the imported cell data
+  if(PointDataMode::Eager == GetPointDataMode())
+  {
+    for(const WrappedDataArrayPtr& wrappedCellData : wrappedDcStruct->m_CellData)
+    {
+      if(cellData->GetArray(qPrintable(wrappedCellData->m_ArrayName)))
+      {
+        RequestPointDataArray(wrappedDcStruct, wrappedCellData->m_ArrayName);
+      }
+    }
+  }
+
   // Add PointData to the vtkDataSet
   vtkPointData* pointData = dataSet->GetPointData();
   for(const WrappedDataArrayPtr& wrappedPointData : wrappedDcStruct->m_PointData)
@@ -554,6 +770,238 @@ void SIMPLVtkBridge::FinishWrappingDataContainerStruct(const WrappedDataContaine
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::SetPointDataMode(PointDataMode mode)
+{
+  ::s_PointDataMode = mode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLVtkBridge::PointDataMode SIMPLVtkBridge::GetPointDataMode()
+{
+  return ::s_PointDataMode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::SetGeometryMode(GeometryMode mode)
+{
+  ::s_GeometryMode = mode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLVtkBridge::GeometryMode SIMPLVtkBridge::GetGeometryMode()
+{
+  return ::s_GeometryMode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataArray) SIMPLVtkBridge::RequestPointDataArray(const WrappedDataContainerPtr& wrappedDc, const QString& arrayName)
+{
+  if(nullptr == wrappedDc || nullptr == wrappedDc->m_DataSet)
+  {
+    return nullptr;
+  }
+
+  auto iter = wrappedDc->m_DerivedPointData.find(arrayName);
+  if(iter != wrappedDc->m_DerivedPointData.end())
+  {
+    return iter->second;
+  }
+
+  VTK_PTR(vtkDataSet) dataSet = wrappedDc->m_DataSet;
+  vtkDataArray* cellArray = dataSet->GetCellData()->GetArray(qPrintable(arrayName));
+  if(nullptr == cellArray)
+  {
+    return nullptr;
+  }
+
+  // Interpolate against a shallow copy containing only the requested array.
+  // Shallow copies share the geometry and array buffers instead of duplicating them.
+  VTK_PTR(vtkDataSet) proxyDataSet = VTK_PTR(vtkDataSet)::Take(dataSet->NewInstance());
+  proxyDataSet->ShallowCopy(dataSet);
+  proxyDataSet->GetPointData()->Initialize();
+  proxyDataSet->GetCellData()->Initialize();
+  proxyDataSet->GetCellData()->AddArray(cellArray);
+
+  VTK_NEW(vtkCellDataToPointData, cell2Point);
+  cell2Point->SetInputData(proxyDataSet);
+  cell2Point->PassCellDataOff();
+  cell2Point->Update();
+
+  VTK_PTR(vtkDataArray) pointArray = cell2Point->GetOutput()->GetPointData()->GetArray(qPrintable(arrayName));
+  if(nullptr == pointArray)
+  {
+    return nullptr;
+  }
+
+  wrappedDc->m_DerivedPointData[arrayName] = pointArray;
+  dataSet->GetPointData()->AddArray(pointArray);
+
+  return pointArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::ReleasePointDataArray(const WrappedDataContainerPtr& wrappedDc, const QString& arrayName)
+{
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  auto iter = wrappedDc->m_DerivedPointData.find(arrayName);
+  if(iter == wrappedDc->m_DerivedPointData.end())
+  {
+    return;
+  }
+
+  if(wrappedDc->m_DataSet)
+  {
+    wrappedDc->m_DataSet->GetPointData()->RemoveArray(qPrintable(arrayName));
+  }
+  wrappedDc->m_DerivedPointData.erase(iter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::ReleasePointDataArrays(const WrappedDataContainerPtr& wrappedDc)
+{
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  if(wrappedDc->m_DataSet)
+  {
+    vtkPointData* pointData = wrappedDc->m_DataSet->GetPointData();
+    for(const auto& derivedArray : wrappedDc->m_DerivedPointData)
+    {
+      pointData->RemoveArray(qPrintable(derivedArray.first));
+    }
+  }
+  wrappedDc->m_DerivedPointData.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::ReleaseTopology(const WrappedDataContainerPtr& wrappedDc)
+{
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  ::VisitMappedImplementation(wrappedDc->m_DataSet, [](auto impl) { impl->ReleaseTopology(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::ReleaseArrayStatistics(const WrappedDataContainerPtr& wrappedDc)
+{
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  VSArrayStatistics* statistics = VSArrayStatistics::Instance();
+  for(const WrappedDataArrayPtr& wrappedArray : wrappedDc->m_CellData)
+  {
+    statistics->release(wrappedArray->m_VtkArray);
+  }
+  for(const WrappedDataArrayPtr& wrappedArray : wrappedDc->m_PointData)
+  {
+    statistics->release(wrappedArray->m_VtkArray);
+  }
+  for(const auto& derivedArray : wrappedDc->m_DerivedPointData)
+  {
+    statistics->release(derivedArray.second);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLVtkBridge::MemoryReport SIMPLVtkBridge::GetMemoryReport(const WrappedDataContainerPtr& wrappedDc)
+{
+  MemoryReport report;
+  if(nullptr == wrappedDc)
+  {
+    return report;
+  }
+
+  report.m_Name = wrappedDc->m_Name;
+
+  // Wrapped arrays reference the SIMPLib buffers through SetVoidArray
+  for(const WrappedDataArrayPtr& wrappedArray : wrappedDc->m_CellData)
+  {
+    report.m_SharedBytes += ::ArrayByteSize(wrappedArray->m_VtkArray);
+  }
+  for(const WrappedDataArrayPtr& wrappedArray : wrappedDc->m_PointData)
+  {
+    report.m_SharedBytes += ::ArrayByteSize(wrappedArray->m_VtkArray);
+  }
+
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(wrappedDc->m_DataSet);
+  if(pointSet && pointSet->GetPoints())
+  {
+    report.m_SharedBytes += ::ArrayByteSize(pointSet->GetPoints()->GetData());
+  }
+
+  // Native mesh connectivity
+  if(vtkPolyData* polyData = vtkPolyData::SafeDownCast(wrappedDc->m_DataSet))
+  {
+    ::AddCellArrayBytes(polyData->GetVerts(), report);
+    ::AddCellArrayBytes(polyData->GetLines(), report);
+    ::AddCellArrayBytes(polyData->GetPolys(), report);
+  }
+  else if(vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(wrappedDc->m_DataSet))
+  {
+    ::AddCellArrayBytes(grid->GetCells(), report);
+  }
+
+  // Point to cell links built on demand by the mapped geometries
+  ::VisitMappedImplementation(wrappedDc->m_DataSet, [&report](auto impl) { report.m_CopiedBytes += impl->GetTopologyMemorySize(); });
+
+  // Interpolated point data is owned by VTK
+  for(const auto& derivedArray : wrappedDc->m_DerivedPointData)
+  {
+    report.m_CopiedBytes += ::ArrayByteSize(derivedArray.second);
+  }
+
+  return report;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLVtkBridge::MemoryReportCollection SIMPLVtkBridge::GetMemoryReport(const WrappedDataContainerPtrCollection& wrappedDcs)
+{
+  MemoryReportCollection reports;
+  for(const WrappedDataContainerPtr& wrappedDc : wrappedDcs)
+  {
+    if(wrappedDc)
+    {
+      reports.push_back(GetMemoryReport(wrappedDc));
+    }
+  }
+
+  return reports;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -618,6 +1066,9 @@ SIMPLVtkBridge::WrappedDataArrayPtr SIMPLVtkBridge::WrapIDataArrayAsStruct(const
   wrappedDataArray->m_SIMPLArray = dataArray;
   wrappedDataArray->m_VtkArray = vtkArray;
 
+  // Compute the ranges and histogram while still on the import thread
+  VSArrayStatistics::Instance()->getStatistics(vtkArray);
+
   return wrappedDataArray;
 }
 
@@ -640,6 +1091,14 @@ VTK_PTR(vtkDataArray) SIMPLVtkBridge::WrapVertices(const SharedVertexList::Point
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const EdgeGeom::Pointer& geom)
 {
+  if(GeometryMode::Native == ::s_GeometryMode)
+  {
+    VTK_NEW(vtkPolyData, polyData);
+    polyData->SetPoints(::WrapPoints(geom->getVertices()));
+    polyData->SetLines(::WrapCellList(geom->getEdges()));
+    return polyData;
+  }
+
   VTK_NEW(VSEdgeGrid, dataSet);
   VSEdgeGeom* edgeGeom = dataSet->GetImplementation();
   edgeGeom->SetGeometry(geom);
@@ -658,17 +1117,31 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const EdgeGeom::Pointer& geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const QuadGeom::Pointer& geom)
 {
-  VTK_NEW(VSQuadGrid, dataSet);
-  VSQuadGeom* quadGeom = dataSet->GetImplementation();
-  quadGeom->SetGeometry(geom);
+#if VTK_MAJOR_VERSION < 9
+  // VTK 8 cell arrays cannot reference the SIMPLib connectivity, so the mapped adapter
+  // remains the zero-copy default there
+  if(GeometryMode::Mapped == ::s_GeometryMode)
+  {
+    VTK_NEW(VSQuadGrid, dataSet);
+    VSQuadGeom* quadGeom = dataSet->GetImplementation();
+    quadGeom->SetGeometry(geom);
 
-  VTK_NEW(vtkPoints, points);
-  VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
-  points->SetDataTypeToFloat();
-  points->SetData(vertexArray);
-  dataSet->SetPoints(points);
+    VTK_NEW(vtkPoints, points);
+    VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
+    points->SetDataTypeToFloat();
+    points->SetData(vertexArray);
+    dataSet->SetPoints(points);
 
-  return dataSet;
+    return dataSet;
+  }
+#endif
+
+  // Surface geometries are wrapped as vtkPolyData so that the view can hand them to the
+  // mapper without running vtkDataSetSurfaceFilter
+  VTK_NEW(vtkPolyData, polyData);
+  polyData->SetPoints(::WrapPoints(geom->getVertices()));
+  polyData->SetPolys(::WrapCellList(geom->getQuads()));
+  return polyData;
 }
 
 // -----------------------------------------------------------------------------
@@ -701,6 +1174,14 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const RectGridGeom::Pointer& ge
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const TetrahedralGeom::Pointer& geom)
 {
+  if(GeometryMode::Native == ::s_GeometryMode)
+  {
+    VTK_NEW(vtkUnstructuredGrid, grid);
+    grid->SetPoints(::WrapPoints(geom->getVertices()));
+    grid->SetCells(VTK_TETRA, ::WrapCellList(geom->getTetrahedra()));
+    return grid;
+  }
+
   VTK_NEW(VSTetrahedralGrid, dataSet);
   VSTetrahedralGeom* tetGeom = dataSet->GetImplementation();
   tetGeom->SetGeometry(geom);
@@ -719,17 +1200,31 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const TetrahedralGeom::Pointer&
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const TriangleGeom::Pointer& geom)
 {
-  VTK_NEW(VtkTriangleGrid, dataSet);
-  VSTriangleGeom* triGeom = dataSet->GetImplementation();
-  triGeom->SetGeometry(geom);
+#if VTK_MAJOR_VERSION < 9
+  // VTK 8 cell arrays cannot reference the SIMPLib connectivity, so the mapped adapter
+  // remains the zero-copy default there
+  if(GeometryMode::Mapped == ::s_GeometryMode)
+  {
+    VTK_NEW(VtkTriangleGrid, dataSet);
+    VSTriangleGeom* triGeom = dataSet->GetImplementation();
+    triGeom->SetGeometry(geom);
 
-  VTK_NEW(vtkPoints, points);
-  VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
-  points->SetDataTypeToFloat();
-  points->SetData(vertexArray);
-  dataSet->SetPoints(points);
+    VTK_NEW(vtkPoints, points);
+    VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
+    points->SetDataTypeToFloat();
+    points->SetData(vertexArray);
+    dataSet->SetPoints(points);
 
-  return dataSet;
+    return dataSet;
+  }
+#endif
+
+  // Surface geometries are wrapped as vtkPolyData so that the view can hand them to the
+  // mapper without running vtkDataSetSurfaceFilter
+  VTK_NEW(vtkPolyData, polyData);
+  polyData->SetPoints(::WrapPoints(geom->getVertices()));
+  polyData->SetPolys(::WrapCellList(geom->getTriangles()));
+  return polyData;
 }
 
 // -----------------------------------------------------------------------------
@@ -737,6 +1232,14 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const TriangleGeom::Pointer& ge
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(const VertexGeom::Pointer& geom)
 {
+  if(GeometryMode::Native == ::s_GeometryMode)
+  {
+    VTK_NEW(vtkPolyData, polyData);
+    polyData->SetPoints(::WrapPoints(geom->getVertices()));
+    polyData->SetVerts(::CreateVertexCells(static_cast<vtkIdType>(geom->getNumberOfVertices())));
+    return polyData;
+  }
+
   VTK_NEW(VSVertexGrid, dataSet);
   VSVertexGeom* vertGeom = dataSet->GetImplementation();
   vertGeom->SetGeometry(geom);
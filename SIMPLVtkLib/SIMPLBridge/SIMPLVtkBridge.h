@@ -102,11 +102,48 @@ public:
     double m_Origin[3] = {0.0, 0.0, 0.0};
     DataArrayImportSettings m_ImportCellArrays;
     DataArrayImportSettings m_ImportPointArrays;
+    std::map<QString, VTK_PTR(vtkDataArray)> m_DerivedPointData;
   };
 
   using WrappedDataContainerPtr = std::shared_ptr<WrappedDataContainer>;
   using WrappedDataContainerPtrCollection = std::vector<WrappedDataContainerPtr>;
 
+  /**
+   * @brief Determines when point data is interpolated from the wrapped cell data.
+   * Lazy only interpolates an array when it is requested through RequestPointDataArray.
+   * Eager interpolates every wrapped cell array while wrapping the DataContainer.
+   * Lazy is the default.  Views request point arrays through VSAbstractFilter::getPointDataArray,
+   * so Eager is only needed by code that reads point arrays straight from the vtkDataSet.
+   */
+  enum class PointDataMode : unsigned char
+  {
+    Lazy = 0,
+    Eager
+  };
+
+  /**
+   * @brief Determines how mesh geometries (Edge, Quad, Tetrahedral, Triangle, and Vertex) are
+   * exposed to VTK.  Mapped wraps the geometry in a vtkMappedUnstructuredGrid that reads the
+   * SIMPLib connectivity one cell at a time.  Native builds a vtkPolyData or vtkUnstructuredGrid
+   * with a real vtkCellArray so that downstream filters can use their fast paths.  With VTK 9
+   * or later, Quad and Triangle geometries are always wrapped as vtkPolyData that references the
+   * SIMPLib connectivity.  VTK 8 would need a copy of the connectivity, so Mapped is kept there.
+   */
+  enum class GeometryMode : unsigned char
+  {
+    Mapped = 0,
+    Native
+  };
+
+  struct MemoryReport
+  {
+    QString m_Name;
+    size_t m_SharedBytes = 0;
+    size_t m_CopiedBytes = 0;
+  };
+
+  using MemoryReportCollection = std::vector<MemoryReport>;
+
   /**
    * @brief Deconstructor
    */
@@ -148,6 +185,81 @@ public:
    */
   static void FinishWrappingDataContainerStruct(const WrappedDataContainerPtr& wrappedDc);
 
+  /**
+   * @brief Sets the PointDataMode used when wrapping DataContainers
+   * @param mode
+   */
+  static void SetPointDataMode(PointDataMode mode);
+
+  /**
+   * @brief Returns the PointDataMode used when wrapping DataContainers
+   * @return
+   */
+  static PointDataMode GetPointDataMode();
+
+  /**
+   * @brief Sets the GeometryMode used when wrapping mesh geometries
+   * @param mode
+   */
+  static void SetGeometryMode(GeometryMode mode);
+
+  /**
+   * @brief Returns the GeometryMode used when wrapping mesh geometries
+   * @return
+   */
+  static GeometryMode GetGeometryMode();
+
+  /**
+   * @brief Returns the point data interpolated from the cell array with the given name and adds it
+   * to the vtkDataSet's point data.  The interpolated array is cached until released and only the
+   * requested array is interpolated.  Returns nullptr if no cell array exists with the given name.
+   * This should never be called outside the main thread once the DataContainer is shown.
+   * @param wrappedDc
+   * @param arrayName
+   * @return
+   */
+  static VTK_PTR(vtkDataArray) RequestPointDataArray(const WrappedDataContainerPtr& wrappedDc, const QString& arrayName);
+
+  /**
+   * @brief Removes the interpolated point data for the given cell array name from the vtkDataSet and releases it
+   * @param wrappedDc
+   * @param arrayName
+   */
+  static void ReleasePointDataArray(const WrappedDataContainerPtr& wrappedDc, const QString& arrayName);
+
+  /**
+   * @brief Removes all interpolated point data from the vtkDataSet and releases it
+   * @param wrappedDc
+   */
+  static void ReleasePointDataArrays(const WrappedDataContainerPtr& wrappedDc);
+
+  /**
+   * @brief Releases the point to cell links built by the mapped mesh geometries.  The
+   * links are rebuilt the next time a VTK algorithm requests the cells using a point.
+   * @param wrappedDc
+   */
+  static void ReleaseTopology(const WrappedDataContainerPtr& wrappedDc);
+
+  /**
+   * @brief Removes the cached VSArrayStatistics for the DataContainer's wrapped arrays
+   * @param wrappedDc
+   */
+  static void ReleaseArrayStatistics(const WrappedDataContainerPtr& wrappedDc);
+
+  /**
+   * @brief Returns the number of bytes shared with SIMPLib and the number of bytes copied for the given DataContainer
+   * @param wrappedDc
+   * @return
+   */
+  static MemoryReport GetMemoryReport(const WrappedDataContainerPtr& wrappedDc);
+
+  /**
+   * @brief Returns a MemoryReport for each of the given DataContainers
+   * @param wrappedDcs
+   * @return
+   */
+  static MemoryReportCollection GetMemoryReport(const WrappedDataContainerPtrCollection& wrappedDcs);
+
   /**
    * @brief Wraps the DataArrays contained within SIMPLib's AttributeMatrix in vtkDataArrays for use in VTK
    * and returns a vector of structs containing information about those vtkDataArrays
@@ -1,6 +1,8 @@
 
 set(VS_SIMPLBridge_SRCS
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSPointCellLinks.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSQuadGeom.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.cpp
@@ -11,6 +13,8 @@ set(VS_SIMPLBridge_SRCS
 set(VS_SIMPLBridge_HDRS
 	#${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkArray.hpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSPointCellLinks.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSQuadGeom.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h
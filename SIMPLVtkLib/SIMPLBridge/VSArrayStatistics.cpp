@@ -0,0 +1,502 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSArrayStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QtCore/QMutexLocker>
+
+#include <vtkSMPThreadLocal.h>
+#include <vtkSMPTools.h>
+
+namespace
+{
+/**
+ * @brief Reads values directly from an array with the standard contiguous layout
+ */
+template <typename T>
+struct PointerAccess
+{
+  const T* m_Values;
+  int m_NumComps;
+
+  inline double get(vtkIdType tupleIdx, int compIdx) const
+  {
+    return static_cast<double>(m_Values[tupleIdx * m_NumComps + compIdx]);
+  }
+};
+
+/**
+ * @brief Reads values through the vtkDataArray API for arrays with other layouts
+ */
+struct DataArrayAccess
+{
+  vtkDataArray* m_Array;
+  int m_NumComps;
+
+  inline double get(vtkIdType tupleIdx, int compIdx) const
+  {
+    return m_Array->GetComponent(tupleIdx, compIdx);
+  }
+};
+
+/**
+ * @brief Finds the range of each component and of the tuple magnitudes.  NaN values
+ * fail every comparison and are skipped.
+ */
+template <typename Access>
+class RangeFunctor
+{
+public:
+  RangeFunctor(const Access& access)
+  : m_Access(access)
+  , m_Ranges(2 * (access.m_NumComps + 1), 0.0)
+  {
+  }
+
+  void Initialize()
+  {
+    std::vector<double>& ranges = m_LocalRanges.Local();
+    ranges.resize(2 * (m_Access.m_NumComps + 1));
+    for(size_t i = 0; i < ranges.size(); i += 2)
+    {
+      ranges[i] = std::numeric_limits<double>::max();
+      ranges[i + 1] = std::numeric_limits<double>::lowest();
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<double>& ranges = m_LocalRanges.Local();
+    const int numComps = m_Access.m_NumComps;
+    if(1 == numComps)
+    {
+      // Branch-free so the compiler can vectorize the reduction
+      double minValue = ranges[0];
+      double maxValue = ranges[1];
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        const double value = m_Access.get(i, 0);
+        minValue = value < minValue ? value : minValue;
+        maxValue = value > maxValue ? value : maxValue;
+      }
+      ranges[0] = minValue;
+      ranges[1] = maxValue;
+      return;
+    }
+
+    double* magnitudeRange = ranges.data() + 2 * numComps;
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      double sumSquares = 0.0;
+      for(int c = 0; c < numComps; c++)
+      {
+        const double value = m_Access.get(i, c);
+        ranges[2 * c] = value < ranges[2 * c] ? value : ranges[2 * c];
+        ranges[2 * c + 1] = value > ranges[2 * c + 1] ? value : ranges[2 * c + 1];
+        sumSquares += value * value;
+      }
+
+      const double magnitude = std::sqrt(sumSquares);
+      magnitudeRange[0] = magnitude < magnitudeRange[0] ? magnitude : magnitudeRange[0];
+      magnitudeRange[1] = magnitude > magnitudeRange[1] ? magnitude : magnitudeRange[1];
+    }
+  }
+
+  void Reduce()
+  {
+    bool first = true;
+    for(auto iter = m_LocalRanges.begin(); iter != m_LocalRanges.end(); ++iter)
+    {
+      const std::vector<double>& ranges = *iter;
+      for(size_t i = 0; i < ranges.size(); i += 2)
+      {
+        m_Ranges[i] = first ? ranges[i] : std::min(m_Ranges[i], ranges[i]);
+        m_Ranges[i + 1] = first ? ranges[i + 1] : std::max(m_Ranges[i + 1], ranges[i + 1]);
+      }
+      first = false;
+    }
+
+    if(1 == m_Access.m_NumComps)
+    {
+      // The magnitude of a scalar is its absolute value
+      const double minValue = m_Ranges[0];
+      const double maxValue = m_Ranges[1];
+      if(minValue >= 0.0)
+      {
+        m_Ranges[2] = minValue;
+        m_Ranges[3] = maxValue;
+      }
+      else if(maxValue <= 0.0)
+      {
+        m_Ranges[2] = -maxValue;
+        m_Ranges[3] = -minValue;
+      }
+      else
+      {
+        m_Ranges[2] = 0.0;
+        m_Ranges[3] = std::max(-minValue, maxValue);
+      }
+    }
+  }
+
+  const std::vector<double>& getRanges() const
+  {
+    return m_Ranges;
+  }
+
+private:
+  Access m_Access;
+  vtkSMPThreadLocal<std::vector<double>> m_LocalRanges;
+  std::vector<double> m_Ranges;
+};
+
+/**
+ * @brief Counts the component values of single component arrays or the tuple magnitudes
+ * of multi-component arrays into evenly sized bins over the given range
+ */
+template <typename Access>
+class HistogramFunctor
+{
+public:
+  HistogramFunctor(const Access& access, const double range[2])
+  : m_Access(access)
+  , m_Min(range[0])
+  , m_Max(range[1])
+  , m_Histogram(VSArrayStatistics::NumberOfBins, 0)
+  {
+    const double width = range[1] - range[0];
+    m_Scale = width > 0.0 ? VSArrayStatistics::NumberOfBins / width : 0.0;
+  }
+
+  void Initialize()
+  {
+    m_LocalHistograms.Local().assign(VSArrayStatistics::NumberOfBins, 0);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<vtkIdType>& histogram = m_LocalHistograms.Local();
+    const int numComps = m_Access.m_NumComps;
+    const int lastBin = VSArrayStatistics::NumberOfBins - 1;
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      double value = 0.0;
+      if(1 == numComps)
+      {
+        value = m_Access.get(i, 0);
+      }
+      else
+      {
+        for(int c = 0; c < numComps; c++)
+        {
+          const double component = m_Access.get(i, c);
+          value += component * component;
+        }
+        value = std::sqrt(value);
+      }
+
+      // Skips NaN values
+      if(!(value >= m_Min && value <= m_Max))
+      {
+        continue;
+      }
+
+      const int bin = std::min(static_cast<int>((value - m_Min) * m_Scale), lastBin);
+      histogram[bin]++;
+    }
+  }
+
+  void Reduce()
+  {
+    for(auto iter = m_LocalHistograms.begin(); iter != m_LocalHistograms.end(); ++iter)
+    {
+      const std::vector<vtkIdType>& histogram = *iter;
+      for(size_t i = 0; i < histogram.size(); i++)
+      {
+        m_Histogram[i] += histogram[i];
+      }
+    }
+  }
+
+  const std::vector<vtkIdType>& getHistogram() const
+  {
+    return m_Histogram;
+  }
+
+private:
+  Access m_Access;
+  double m_Min;
+  double m_Max;
+  double m_Scale = 0.0;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> m_LocalHistograms;
+  std::vector<vtkIdType> m_Histogram;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Access>
+void ComputeStatistics(const Access& access, vtkIdType numTuples, VSArrayStatistics::Statistics& statistics)
+{
+  const int numComps = access.m_NumComps;
+
+  RangeFunctor<Access> rangeFunctor(access);
+  vtkSMPTools::For(0, numTuples, rangeFunctor);
+  const std::vector<double>& ranges = rangeFunctor.getRanges();
+
+  statistics.m_ComponentRanges.assign(ranges.begin(), ranges.begin() + 2 * numComps);
+  statistics.m_MagnitudeRange[0] = ranges[2 * numComps];
+  statistics.m_MagnitudeRange[1] = ranges[2 * numComps + 1];
+
+  const double* histogramRange = (1 == numComps) ? ranges.data() : statistics.m_MagnitudeRange;
+  statistics.m_HistogramRange[0] = histogramRange[0];
+  statistics.m_HistogramRange[1] = histogramRange[1];
+
+  HistogramFunctor<Access> histogramFunctor(access, statistics.m_HistogramRange);
+  vtkSMPTools::For(0, numTuples, histogramFunctor);
+  statistics.m_Histogram = histogramFunctor.getHistogram();
+
+  statistics.m_HistogramCount = 0;
+  for(vtkIdType count : statistics.m_Histogram)
+  {
+    statistics.m_HistogramCount += count;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void ComputeTypedStatistics(vtkDataArray* array, VSArrayStatistics::Statistics& statistics)
+{
+  PointerAccess<T> access;
+  access.m_Values = static_cast<const T*>(array->GetVoidPointer(0));
+  access.m_NumComps = array->GetNumberOfComponents();
+  ComputeStatistics(access, array->GetNumberOfTuples(), statistics);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSArrayStatistics::Statistics::getRange(int component, double range[2]) const
+{
+  if(-1 == component)
+  {
+    range[0] = m_MagnitudeRange[0];
+    range[1] = m_MagnitudeRange[1];
+    return true;
+  }
+
+  if(component < 0 || static_cast<size_t>(2 * component + 1) >= m_ComponentRanges.size())
+  {
+    return false;
+  }
+
+  range[0] = m_ComponentRanges[2 * component];
+  range[1] = m_ComponentRanges[2 * component + 1];
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSArrayStatistics::Statistics::getValueAtFraction(double fraction) const
+{
+  if(m_HistogramCount <= 0 || m_Histogram.empty())
+  {
+    return m_HistogramRange[0];
+  }
+
+  fraction = std::min(std::max(fraction, 0.0), 1.0);
+  const double target = fraction * m_HistogramCount;
+  const double binWidth = (m_HistogramRange[1] - m_HistogramRange[0]) / m_Histogram.size();
+
+  double count = 0.0;
+  for(size_t i = 0; i < m_Histogram.size(); i++)
+  {
+    const double binCount = static_cast<double>(m_Histogram[i]);
+    if(binCount > 0.0 && count + binCount >= target)
+    {
+      const double binFraction = (target - count) / binCount;
+      return m_HistogramRange[0] + (i + binFraction) * binWidth;
+    }
+    count += binCount;
+  }
+
+  return m_HistogramRange[1];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatistics* VSArrayStatistics::Instance()
+{
+  static VSArrayStatistics* instance = new VSArrayStatistics();
+  return instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatistics::StatisticsPtr VSArrayStatistics::getStatistics(vtkDataArray* array)
+{
+  if(nullptr == array)
+  {
+    return nullptr;
+  }
+
+  {
+    QMutexLocker locker(&m_Lock);
+    auto iter = m_Entries.find(array);
+    if(iter != m_Entries.end() && iter->second.m_Array == array && iter->second.m_ArrayTime == array->GetMTime())
+    {
+      return iter->second.m_Statistics;
+    }
+  }
+
+  // Compute without holding the lock so other arrays can be read in the meantime
+  vtkMTimeType arrayTime = array->GetMTime();
+  StatisticsPtr statistics = Compute(array);
+
+  QMutexLocker locker(&m_Lock);
+  if(m_Entries.size() >= m_PruneSize)
+  {
+    pruneDeletedArrays();
+  }
+
+  Entry& entry = m_Entries[array];
+  entry.m_Array = array;
+  entry.m_ArrayTime = arrayTime;
+  entry.m_Statistics = statistics;
+  return statistics;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSArrayStatistics::getRange(vtkDataArray* array, int component, double range[2])
+{
+  StatisticsPtr statistics = getStatistics(array);
+  if(nullptr == statistics)
+  {
+    return false;
+  }
+
+  return statistics->getRange(component, range);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatistics::release(vtkDataArray* array)
+{
+  QMutexLocker locker(&m_Lock);
+  m_Entries.erase(array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatistics::clear()
+{
+  QMutexLocker locker(&m_Lock);
+  m_Entries.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayStatistics::pruneDeletedArrays()
+{
+  for(auto iter = m_Entries.begin(); iter != m_Entries.end();)
+  {
+    if(nullptr == iter->second.m_Array)
+    {
+      iter = m_Entries.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  // Grow the threshold with the number of live arrays to keep pruning amortized
+  m_PruneSize = std::max<size_t>(256, 2 * m_Entries.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatistics::StatisticsPtr VSArrayStatistics::Compute(vtkDataArray* array)
+{
+  if(nullptr == array || array->GetNumberOfComponents() < 1)
+  {
+    return nullptr;
+  }
+
+  std::shared_ptr<Statistics> statistics = std::make_shared<Statistics>();
+  if(array->GetNumberOfTuples() <= 0)
+  {
+    statistics->m_ComponentRanges.assign(2 * array->GetNumberOfComponents(), 0.0);
+    statistics->m_Histogram.assign(NumberOfBins, 0);
+    return statistics;
+  }
+
+  if(array->HasStandardMemoryLayout())
+  {
+    switch(array->GetDataType())
+    {
+      vtkTemplateMacro(ComputeTypedStatistics<VTK_TT>(array, *statistics));
+    default:
+      break;
+    }
+  }
+
+  if(statistics->m_ComponentRanges.empty())
+  {
+    DataArrayAccess access;
+    access.m_Array = array;
+    access.m_NumComps = array->GetNumberOfComponents();
+    ComputeStatistics(access, array->GetNumberOfTuples(), *statistics);
+  }
+
+  return statistics;
+}
@@ -0,0 +1,159 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QMutex>
+
+#include <vtkDataArray.h>
+#include <vtkType.h>
+#include <vtkWeakPointer.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSArrayStatistics VSArrayStatistics.h SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.h
+ * @brief This class caches the value ranges and histogram of vtkDataArrays so that
+ * the color mapping and threshold widgets do not rescan large arrays every time they
+ * need a range.  Statistics are computed in parallel the first time they are requested
+ * and are recomputed if the array is modified afterwards.  Wrapped SIMPLib arrays are
+ * computed when they are wrapped.
+ */
+class SIMPLVtkLib_EXPORT VSArrayStatistics
+{
+public:
+  /**
+   * @brief Ranges and histogram for a single vtkDataArray.  The histogram covers
+   * the component range for single component arrays and the magnitude range otherwise.
+   */
+  struct Statistics
+  {
+    std::vector<double> m_ComponentRanges;
+    double m_MagnitudeRange[2] = {0.0, 0.0};
+    double m_HistogramRange[2] = {0.0, 0.0};
+    std::vector<vtkIdType> m_Histogram;
+    vtkIdType m_HistogramCount = 0;
+
+    /**
+     * @brief Copies the range for the given component into range.  A component of
+     * -1 copies the magnitude range.  Returns false if the component is out of range.
+     * @param component
+     * @param range
+     * @return
+     */
+    bool getRange(int component, double range[2]) const;
+
+    /**
+     * @brief Returns the value below which the given fraction of the histogrammed
+     * values fall.  The value is interpolated within the bin containing it.
+     * @param fraction
+     * @return
+     */
+    double getValueAtFraction(double fraction) const;
+  };
+
+  using StatisticsPtr = std::shared_ptr<const Statistics>;
+
+  static const int NumberOfBins = 256;
+
+  /**
+   * @brief Returns the cache shared by all filters and views
+   * @return
+   */
+  static VSArrayStatistics* Instance();
+
+  /**
+   * @brief Returns the statistics for the given array, computing them if they are not
+   * cached or the array has been modified since they were computed.
+   * @param array
+   * @return
+   */
+  StatisticsPtr getStatistics(vtkDataArray* array);
+
+  /**
+   * @brief Convenience method that copies the cached range for the given component into
+   * range.  A component of -1 copies the magnitude range.  Returns false if the range is
+   * not available.
+   * @param array
+   * @param component
+   * @param range
+   * @return
+   */
+  bool getRange(vtkDataArray* array, int component, double range[2]);
+
+  /**
+   * @brief Removes the statistics for the given array
+   * @param array
+   */
+  void release(vtkDataArray* array);
+
+  /**
+   * @brief Removes all cached statistics
+   */
+  void clear();
+
+  /**
+   * @brief Computes the statistics for the given array without using the cache
+   * @param array
+   * @return
+   */
+  static StatisticsPtr Compute(vtkDataArray* array);
+
+protected:
+  VSArrayStatistics() = default;
+
+  /**
+   * @brief Removes statistics for arrays that have been deleted.  Requires the cache
+   * lock to be held.
+   */
+  void pruneDeletedArrays();
+
+private:
+  struct Entry
+  {
+    vtkWeakPointer<vtkDataArray> m_Array;
+    vtkMTimeType m_ArrayTime = 0;
+    StatisticsPtr m_Statistics;
+  };
+
+  std::map<vtkDataArray*, Entry> m_Entries;
+  size_t m_PruneSize = 256;
+  QMutex m_Lock;
+};
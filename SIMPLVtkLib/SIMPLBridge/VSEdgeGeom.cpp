@@ -85,7 +85,7 @@ VSEdgeGeom::VSEdgeGeom()
 void VSEdgeGeom::SetGeometry(EdgeGeom::Pointer geom)
 {
   m_Geom = geom;
-  m_Geom->findElementsContainingVert();
+  m_PointCells.release();
 }
 
 // -----------------------------------------------------------------------------
@@ -137,15 +137,14 @@ void VSEdgeGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSEdgeGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == m_Geom)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->SetNumberOfIds(0);
+    return;
   }
+
+  VSPointCellLinks::LinksPtr links = m_PointCells.getLinks(m_Geom->getEdges(), m_Geom->getNumberOfVertices());
+  links->getPointCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -153,7 +152,23 @@ void VSEdgeGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 // -----------------------------------------------------------------------------
 int VSEdgeGeom::GetMaxCellSize()
 {
-  return std::ceil(m_MaxCellSize);
+  return 2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSEdgeGeom::ReleaseTopology()
+{
+  m_PointCells.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSEdgeGeom::GetTopologyMemorySize() const
+{
+  return m_PointCells.getMemorySize();
 }
 
 // -----------------------------------------------------------------------------
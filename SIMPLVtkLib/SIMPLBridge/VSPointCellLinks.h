@@ -0,0 +1,210 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <vtkIdList.h>
+#include <vtkSMPTools.h>
+#include <vtkType.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSPointCellLinks VSPointCellLinks.h SIMPLVtkLib/SIMPLBridge/VSPointCellLinks.h
+ * @brief This class stores the point to cell links used by the vtkMappedUnstructuredGrid
+ * implementations.  The links are only built the first time they are requested and are
+ * built in parallel from the SIMPLib connectivity list.  Requests from multiple threads
+ * are safe and the links can be released at any time to reclaim memory.  Threads that
+ * are still using released links keep them alive until they are done.
+ */
+class SIMPLVtkLib_EXPORT VSPointCellLinks
+{
+public:
+  /**
+   * @brief Compressed point to cell links.  The cells using point p are stored in
+   * m_Cells from m_Offsets[p] to m_Offsets[p + 1].
+   */
+  struct Links
+  {
+    std::vector<vtkIdType> m_Offsets;
+    std::vector<vtkIdType> m_Cells;
+
+    /**
+     * @brief Gets a list of cell IDs that use the given point ID
+     * @param ptId
+     * @param cellIds
+     */
+    void getPointCells(vtkIdType ptId, vtkIdList* cellIds) const;
+
+    /**
+     * @brief Returns the number of bytes used by the links
+     * @return
+     */
+    size_t getMemorySize() const;
+  };
+
+  using LinksPtr = std::shared_ptr<const Links>;
+
+  VSPointCellLinks() = default;
+  virtual ~VSPointCellLinks() = default;
+
+  VSPointCellLinks(const VSPointCellLinks&) = delete;
+  VSPointCellLinks& operator=(const VSPointCellLinks&) = delete;
+
+  /**
+   * @brief Returns the links for the given connectivity list, building them if they
+   * have not been built since the last release.
+   * @param cellList
+   * @param numPoints
+   * @return
+   */
+  template <typename ListPointer>
+  LinksPtr getLinks(const ListPointer& cellList, size_t numPoints)
+  {
+    LinksPtr links = std::atomic_load(&m_Links);
+    if(links)
+    {
+      return links;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Lock);
+    links = std::atomic_load(&m_Links);
+    if(nullptr == links)
+    {
+      links = Build(cellList->getPointer(0), static_cast<vtkIdType>(cellList->getNumberOfTuples()), static_cast<vtkIdType>(cellList->getNumberOfComponents()),
+                    static_cast<vtkIdType>(numPoints));
+      std::atomic_store(&m_Links, links);
+    }
+
+    return links;
+  }
+
+  /**
+   * @brief Returns true if the links are currently built.  Returns false otherwise.
+   * @return
+   */
+  bool isBuilt() const;
+
+  /**
+   * @brief Releases the links.  They are rebuilt on the next request.
+   */
+  void release();
+
+  /**
+   * @brief Returns the number of bytes used by the links
+   * @return
+   */
+  size_t getMemorySize() const;
+
+protected:
+  /**
+   * @brief Builds the links from a connectivity list with cellSize points per cell
+   * @param connectivity
+   * @param numCells
+   * @param cellSize
+   * @param numPoints
+   * @return
+   */
+  template <typename IndexType>
+  static LinksPtr Build(const IndexType* connectivity, vtkIdType numCells, vtkIdType cellSize, vtkIdType numPoints)
+  {
+    std::shared_ptr<Links> links = std::make_shared<Links>();
+    links->m_Offsets.resize(numPoints + 1, 0);
+    links->m_Cells.resize(numCells * cellSize);
+
+    // Count the cells using each point
+    std::unique_ptr<std::atomic<vtkIdType>[]> counts(new std::atomic<vtkIdType>[numPoints]);
+    vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        counts[i].store(0, std::memory_order_relaxed);
+      }
+    });
+    vtkSMPTools::For(0, numCells * cellSize, [&](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        vtkIdType ptId = static_cast<vtkIdType>(connectivity[i]);
+        if(ptId >= 0 && ptId < numPoints)
+        {
+          counts[ptId].fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+
+    // Convert the counts to offsets and reuse them as insertion cursors
+    for(vtkIdType i = 0; i < numPoints; i++)
+    {
+      vtkIdType count = counts[i].load(std::memory_order_relaxed);
+      links->m_Offsets[i + 1] = links->m_Offsets[i] + count;
+      counts[i].store(links->m_Offsets[i], std::memory_order_relaxed);
+    }
+
+    vtkIdType* cells = links->m_Cells.data();
+    vtkSMPTools::For(0, numCells * cellSize, [&](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        vtkIdType ptId = static_cast<vtkIdType>(connectivity[i]);
+        if(ptId >= 0 && ptId < numPoints)
+        {
+          cells[counts[ptId].fetch_add(1, std::memory_order_relaxed)] = i / cellSize;
+        }
+      }
+    });
+
+    // Keep each point's cells in ascending order regardless of thread scheduling
+    const vtkIdType* offsets = links->m_Offsets.data();
+    vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType i = begin; i < end; i++)
+      {
+        std::sort(cells + offsets[i], cells + offsets[i + 1]);
+      }
+    });
+
+    links->m_Cells.resize(links->m_Offsets[numPoints]);
+    return links;
+  }
+
+private:
+  LinksPtr m_Links = nullptr;
+  mutable std::mutex m_Lock;
+};
@@ -86,7 +86,7 @@ VSQuadGeom::VSQuadGeom()
 void VSQuadGeom::SetGeometry(QuadGeom::Pointer geom)
 {
   m_Geom = geom;
-  m_Geom->findElementsContainingVert();
+  m_PointCells.release();
 }
 
 // -----------------------------------------------------------------------------
@@ -138,15 +138,14 @@ void VSQuadGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSQuadGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == m_Geom)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->SetNumberOfIds(0);
+    return;
   }
+
+  VSPointCellLinks::LinksPtr links = m_PointCells.getLinks(m_Geom->getQuads(), m_Geom->getNumberOfVertices());
+  links->getPointCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -154,7 +153,23 @@ void VSQuadGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 // -----------------------------------------------------------------------------
 int VSQuadGeom::GetMaxCellSize()
 {
-  return std::ceil(m_MaxCellSize);
+  return 4;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSQuadGeom::ReleaseTopology()
+{
+  m_PointCells.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSQuadGeom::GetTopologyMemorySize() const
+{
+  return m_PointCells.getMemorySize();
 }
 
 // -----------------------------------------------------------------------------
@@ -40,6 +40,8 @@
 
 #include "SIMPLib/Geometry/QuadGeom.h"
 
+#include "SIMPLVtkLib/SIMPLBridge/VSPointCellLinks.h"
+
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 /**
@@ -95,6 +97,18 @@ public:
    */
   int GetMaxCellSize();
 
+  /**
+   * @brief Releases the point to cell links.  The links are rebuilt the next time
+   * GetPointCells is called.
+   */
+  void ReleaseTopology();
+
+  /**
+   * @brief Returns the number of bytes used by the point to cell links
+   * @return
+   */
+  size_t GetTopologyMemorySize() const;
+
   /**
    * @brief Gets a list of all cell IDs of a given type
    * @param type
@@ -159,7 +173,7 @@ protected:
 
 private:
   QuadGeom::Pointer m_Geom = nullptr;
-  float m_MaxCellSize = 0.0f;
+  VSPointCellLinks m_PointCells;
 };
 
 vtkMakeMappedUnstructuredGrid(VSQuadGrid, VSQuadGeom)
@@ -83,6 +83,7 @@ VSTetrahedralGeom::VSTetrahedralGeom()
 void VSTetrahedralGeom::SetGeometry(TetrahedralGeom::Pointer geom)
 {
   m_Geom = geom;
+  m_PointCells.release();
 }
 
 // -----------------------------------------------------------------------------
@@ -134,15 +135,14 @@ void VSTetrahedralGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSTetrahedralGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == m_Geom)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->SetNumberOfIds(0);
+    return;
   }
+
+  VSPointCellLinks::LinksPtr links = m_PointCells.getLinks(m_Geom->getTetrahedra(), m_Geom->getNumberOfVertices());
+  links->getPointCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -150,7 +150,23 @@ void VSTetrahedralGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 // -----------------------------------------------------------------------------
 int VSTetrahedralGeom::GetMaxCellSize()
 {
-  return std::ceil(m_MaxCellSize);
+  return 4;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTetrahedralGeom::ReleaseTopology()
+{
+  m_PointCells.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSTetrahedralGeom::GetTopologyMemorySize() const
+{
+  return m_PointCells.getMemorySize();
 }
 
 // -----------------------------------------------------------------------------
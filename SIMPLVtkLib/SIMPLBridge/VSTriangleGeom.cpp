@@ -86,8 +86,7 @@ VSTriangleGeom::VSTriangleGeom()
 void VSTriangleGeom::SetGeometry(TriangleGeom::Pointer geom)
 {
   m_Geom = geom;
-  geom->findElementsContainingVert();
-  geom->findElementSizes();
+  m_PointCells.release();
 }
 
 // -----------------------------------------------------------------------------
@@ -139,15 +138,14 @@ void VSTriangleGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSTriangleGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, size_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(nullptr == m_Geom)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    cellIds->SetNumberOfIds(0);
+    return;
   }
+
+  VSPointCellLinks::LinksPtr links = m_PointCells.getLinks(m_Geom->getTriangles(), m_Geom->getNumberOfVertices());
+  links->getPointCells(ptId, cellIds);
 }
 
 // -----------------------------------------------------------------------------
@@ -155,7 +153,23 @@ void VSTriangleGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 // -----------------------------------------------------------------------------
 int VSTriangleGeom::GetMaxCellSize()
 {
-  return std::ceil(m_MaxCellSize);
+  return 3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTriangleGeom::ReleaseTopology()
+{
+  m_PointCells.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSTriangleGeom::GetTopologyMemorySize() const
+{
+  return m_PointCells.getMemorySize();
 }
 
 // -----------------------------------------------------------------------------
@@ -130,13 +130,9 @@ void VSVertexGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
 // -----------------------------------------------------------------------------
 void VSVertexGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
-  // No implementation in VertexGeom
-  int count = m_Geom->getVertices()->getNumberOfTuples();
-
-  for(int i = 0; i < count; i++)
-  {
-    cellIds->SetId(i, i);
-  }
+  // Each vertex is its own cell
+  cellIds->SetNumberOfIds(1);
+  cellIds->SetId(0, ptId);
 }
 
 // -----------------------------------------------------------------------------
@@ -144,7 +140,22 @@ void VSVertexGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 // -----------------------------------------------------------------------------
 int VSVertexGeom::GetMaxCellSize()
 {
-  return std::ceil(m_MaxCellSize);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVertexGeom::ReleaseTopology()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSVertexGeom::GetTopologyMemorySize() const
+{
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
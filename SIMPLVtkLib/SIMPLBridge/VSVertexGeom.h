@@ -95,6 +95,18 @@ public:
    */
   int GetMaxCellSize();
 
+  /**
+   * @brief Releases the point to cell links.  The links are rebuilt the next time
+   * GetPointCells is called.
+   */
+  void ReleaseTopology();
+
+  /**
+   * @brief Returns the number of bytes used by the point to cell links
+   * @return
+   */
+  size_t GetTopologyMemorySize() const;
+
   /**
    * @brief Gets a list of all cell IDs of a given type
    * @param type
@@ -159,7 +171,6 @@ protected:
 
 private:
   VertexGeom::Pointer m_Geom = nullptr;
-  float m_MaxCellSize = 0.0f;
 };
 
 vtkMakeMappedUnstructuredGrid(VSVertexGrid, VSVertexGeom)
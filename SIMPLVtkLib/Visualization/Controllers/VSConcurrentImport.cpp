@@ -41,8 +41,9 @@
 
 #include "VSConcurrentImport.h"
 
+#include <algorithm>
+
 #include <QtConcurrent>
-#include <QtCore/QFutureWatcher>
 
 #include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
@@ -54,22 +55,15 @@
 VSConcurrentImport::VSConcurrentImport(VSController* controller)
 : QObject(controller)
 , m_Controller(controller)
-, m_ImportDataContainerOrderLock(1)
-, m_UnappliedDataFilterLock(1)
-, m_AppliedDataFilterLock(1)
-, m_FilterLock(1)
-, m_WrappedDcLock(1)
-, m_PartialWrappingThreadCountLock(1)
-, m_AppliedThreadCountLock(1)
-, m_AppliedFilterCountLock(1)
 {
   if(controller && controller->getFilterModel())
   {
     connect(this, SIGNAL(importedFilter(VSAbstractFilter*, bool)), controller->getFilterModel(), SLOT(addFilter(VSAbstractFilter*, bool)));
   }
 
-  connect(this, SIGNAL(finishedPartialWrapping()), this, SLOT(partialWrappingThreadFinished()));
-  connect(this, SIGNAL(finishedApplying()), this, SLOT(applyDataFiltersThreadFinished()));
+  // Worker threads emit these signals so that the connected slots run on the main thread
+  connect(this, SIGNAL(dataContainerWrapped(int, int)), this, SLOT(createDataFilter(int, int)), Qt::QueuedConnection);
+  connect(this, SIGNAL(dataFilterFinished(int, int)), this, SLOT(updateImportProgress(int, int)), Qt::QueuedConnection);
 
   int threadsUsed = 2;
   m_ThreadCount = QThreadPool::globalInstance()->maxThreadCount();
@@ -117,6 +111,14 @@ void VSConcurrentImport::addDataContainerArray(VSFileNameFilter* fileFilter, Dat
   addDataContainerArray(std::make_pair(fileFilter, dca));
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSConcurrentImport::addEvictedDataContainerArray(VSFileNameFilter* fileFilter, DataContainerArray::Pointer dca)
+{
+  m_EvictedList.push_back(std::make_pair(fileFilter, dca));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -130,202 +132,176 @@ void VSConcurrentImport::addDataContainerArray(DcaGenericPair fileDcPair)
 // -----------------------------------------------------------------------------
 void VSConcurrentImport::run()
 {
+  ImportBatchPtr batch = std::make_shared<ImportBatch>();
+  batch->m_Id = m_NextBatchId++;
+
   while(m_WrappedList.size() > 0)
   {
     DcaGenericPair filePair = m_WrappedList.front();
-    importDataContainerArray(filePair);
+    importDataContainerArray(filePair, batch, false);
 
     m_WrappedList.pop_front();
   }
+
+  while(m_EvictedList.size() > 0)
+  {
+    DcaGenericPair filePair = m_EvictedList.front();
+    importDataContainerArray(filePair, batch, true);
+
+    m_EvictedList.pop_front();
+  }
+
+  if(batch->m_Tasks.empty())
+  {
+    return;
+  }
+
+  m_ImportBatches[batch->m_Id] = batch;
+  emit applyingDataFilters(static_cast<int>(batch->m_Tasks.size()));
+
+  int threadCount = std::min(m_ThreadCount, static_cast<int>(batch->m_Tasks.size()));
+  for(int i = 0; i < threadCount; i++)
+  {
+    QtConcurrent::run(this, &VSConcurrentImport::wrapDataContainers, batch);
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::importDataContainerArray(DcaGenericPair genericPair)
+void VSConcurrentImport::importDataContainerArray(DcaGenericPair genericPair, const ImportBatchPtr& batch, bool evicted)
 {
-  m_DataParentFilter = genericPair.first;
+  VSTextFilter* parentFilter = genericPair.first;
   DataContainerArray::Pointer dca = genericPair.second;
 
   VSFilterModel* filterModel = m_Controller->getFilterModel();
 
   auto currentFilters = filterModel->getAllFilters();
-  bool parentFilterFound = (std::find(currentFilters.begin(), currentFilters.end(), m_DataParentFilter) != currentFilters.end());
+  bool parentFilterFound = (std::find(currentFilters.begin(), currentFilters.end(), parentFilter) != currentFilters.end());
   if(!parentFilterFound)
   {
-    filterModel->addFilter(m_DataParentFilter);
+    filterModel->addFilter(parentFilter);
   }
 
-  m_ImportDataContainerQueue = dca->getDataContainers();
-
-  for(int i = 0; i < m_ImportDataContainerQueue.size(); i++)
+  if(nullptr == dca)
   {
-    DataContainer::Pointer dc = m_ImportDataContainerQueue[i];
-    m_DataContainerIndexMap.insert(dc, i);
+    return;
   }
 
-  m_WrappedDataContainers.resize(m_ImportDataContainerQueue.size());
-  m_UnappliedDataFilters.resize(m_ImportDataContainerQueue.size());
-  m_AppliedDataFilters.resize(m_ImportDataContainerQueue.size());
-
-  emit blockRender(true);
-
-  // Wait for the filter lock
-  m_FilterLock.acquire();
-
-  m_PartialWrappingThreadCountLock.acquire();
-  m_PartialWrappingThreadsRemaining = m_ThreadCount;
-  m_PartialWrappingThreadCountLock.release();
-  m_AppliedThreadCountLock.acquire();
-  m_AppliedThreadsRemaining = m_ThreadCount;
-  m_AppliedThreadCountLock.release();
-
-  for(int i = 0; i < m_ThreadCount; i++)
+  DataContainerArray::Container dataContainers = dca->getDataContainers();
+  batch->m_Tasks.reserve(batch->m_Tasks.size() + dataContainers.size());
+  for(const DataContainer::Pointer& dc : dataContainers)
   {
-    QtConcurrent::run(this, &VSConcurrentImport::wrapDataContainer);
+    ImportTask task;
+    task.m_DataContainer = dc;
+    task.m_ParentFilter = parentFilter;
+    task.m_Evicted = evicted;
+    batch->m_Tasks.push_back(task);
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::partialWrappingThreadFinished()
+void VSConcurrentImport::wrapDataContainers(ImportBatchPtr batch)
 {
-  // Threads remaining lock
-  m_PartialWrappingThreadCountLock.acquire();
-  m_PartialWrappingThreadsRemaining--;
-  if(m_PartialWrappingThreadsRemaining <= 0)
+  const int taskCount = static_cast<int>(batch->m_Tasks.size());
+  int taskIndex = batch->m_NextWrapIndex.fetchAndAddOrdered(1);
+  while(taskIndex < taskCount)
   {
-    m_PartialWrappingThreadCountLock.release();
-
-    for(SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc : m_WrappedDataContainers)
-    {
-      VSSIMPLDataContainerFilter* filter = new VSSIMPLDataContainerFilter(wrappedDc, m_DataParentFilter);
-      DataContainer::Pointer dataContainer = wrappedDc->m_DataContainer;
-      ImageGeom::Pointer imageGeom = dataContainer->getGeometryAs<ImageGeom>();
-      FloatVec3Type originTuple = imageGeom->getOrigin();
-      double origin[3];
-      origin[0] = originTuple[0];
-      origin[1] = originTuple[1];
-      origin[2] = originTuple[2];
-
-      filter->getTransform()->setLocalPosition(origin);
-      filter->getTransform()->setOriginPosition(origin);
-
-      // Attempting to run applyDataFilters requires the QSemaphore to lock when modifying this vector
-      m_UnappliedDataFilterLock.acquire();
-      int index = m_DataContainerIndexMap.value(filter->getWrappedDataContainer()->m_DataContainer);
-      m_UnappliedDataFilters[index] = filter;
-      m_UnappliedDataFilterLock.release();
-    }
-
-    m_AppliedFilterCountLock.acquire();
-    m_AppliedFilterCount = 0;
-    m_AppliedFilterCountLock.release();
-    m_WrappedDataContainers.clear();
-    emit blockRender(false);
-    m_FilterLock.release();
-
-    m_UnappliedDataFilterLock.acquire();
-    emit applyingDataFilters(m_UnappliedDataFilters.size());
-    m_UnappliedDataFilterLock.release();
-
-    // Apply the filters only after all DataContainers for all files have been wrapped
-    if(m_WrappedList.size() == 0)
-    {
-      // Apply filters on multiple threads
-      for(int i = 0; i < m_ThreadCount; i++)
-      {
-        QFuture<void> future = QtConcurrent::run(this, &VSConcurrentImport::applyDataFilters);
-      }
-    }
+    // Each task is only ever claimed by a single thread
+    ImportTask& task = batch->m_Tasks[taskIndex];
+    task.m_WrappedDc = SIMPLVtkBridge::WrapGeometryPtr(task.m_DataContainer);
+    emit dataContainerWrapped(batch->m_Id, taskIndex);
+
+    taskIndex = batch->m_NextWrapIndex.fetchAndAddOrdered(1);
   }
-  m_PartialWrappingThreadCountLock.release();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::wrapDataContainer()
+void VSConcurrentImport::createDataFilter(int batchId, int taskIndex)
 {
-  m_ImportDataContainerOrderLock.acquire();
-  while(m_ImportDataContainerQueue.size() > 0)
+  auto batchIter = m_ImportBatches.find(batchId);
+  if(batchIter == m_ImportBatches.end())
+  {
+    return;
+  }
+
+  ImportBatchPtr batch = batchIter->second;
+  ImportTask& task = batch->m_Tasks[taskIndex];
+  if(nullptr == task.m_WrappedDc)
+  {
+    // The DataContainer could not be wrapped
+    completeTask(batch);
+    return;
+  }
+
+  VSSIMPLDataContainerFilter* filter = new VSSIMPLDataContainerFilter(task.m_WrappedDc, task.m_ParentFilter);
+  ImageGeom::Pointer imageGeom = task.m_DataContainer->getGeometryAs<ImageGeom>();
+  if(imageGeom)
+  {
+    FloatVec3Type originTuple = imageGeom->getOrigin();
+    double origin[3];
+    origin[0] = originTuple[0];
+    origin[1] = originTuple[1];
+    origin[2] = originTuple[2];
+
+    filter->getTransform()->setLocalPosition(origin);
+    filter->getTransform()->setOriginPosition(origin);
+  }
+
+  task.m_Filter = filter;
+  task.m_WrappedDc = nullptr;
+
+  // Evicted DataContainers have nothing left to wrap until their arrays are read
+  if(task.m_Evicted)
   {
-    DataContainer::Pointer dc = m_ImportDataContainerQueue.front();
-    m_ImportDataContainerQueue.erase(m_ImportDataContainerQueue.begin());
-    m_ImportDataContainerOrderLock.release();
-
-    SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = SIMPLVtkBridge::WrapGeometryPtr(dc);
-    if(wrappedDc)
-    {
-      m_WrappedDcLock.acquire();
-      int index = m_DataContainerIndexMap.value(dc);
-      m_WrappedDataContainers[index] = wrappedDc;
-      m_WrappedDcLock.release();
-    }
-
-    // Lock the semaphore before the while loop checks
-    m_ImportDataContainerOrderLock.acquire();
+    filter->importEvicted();
+    completeTask(batch);
+    return;
   }
-  m_ImportDataContainerOrderLock.release();
 
-  emit finishedPartialWrapping();
+  QtConcurrent::run(this, &VSConcurrentImport::finishDataFilter, batch, taskIndex);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::applyDataFilters()
+void VSConcurrentImport::finishDataFilter(ImportBatchPtr batch, int taskIndex)
 {
-  m_UnappliedDataFilterLock.acquire();
-  while(m_UnappliedDataFilters.size() > 0)
-  {
-    VSSIMPLDataContainerFilter* filter = m_UnappliedDataFilters.front();
-    m_UnappliedDataFilters.erase(m_UnappliedDataFilters.begin());
-    m_UnappliedDataFilterLock.release();
-
-    filter->finishWrapping();
-
-    m_AppliedFilterCountLock.acquire();
-    emit dataFilterApplied(++m_AppliedFilterCount);
-    m_AppliedFilterCountLock.release();
+  batch->m_Tasks[taskIndex].m_Filter->finishWrapping();
+  emit dataFilterFinished(batch->m_Id, taskIndex);
+}
 
-    m_AppliedDataFilterLock.acquire();
-    int index = m_DataContainerIndexMap.value(filter->getWrappedDataContainer()->m_DataContainer);
-    m_AppliedDataFilters[index] = filter;
-    m_AppliedDataFilterLock.release();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSConcurrentImport::updateImportProgress(int batchId, int taskIndex)
+{
+  Q_UNUSED(taskIndex)
 
-    // Lock semaphore before the while statement is checked again
-    m_UnappliedDataFilterLock.acquire();
+  auto batchIter = m_ImportBatches.find(batchId);
+  if(batchIter == m_ImportBatches.end())
+  {
+    return;
   }
-  m_UnappliedDataFilterLock.release();
 
-  emit finishedApplying();
+  ImportBatchPtr batch = batchIter->second;
+  completeTask(batch);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSConcurrentImport::applyDataFiltersThreadFinished()
+void VSConcurrentImport::completeTask(const ImportBatchPtr& batch)
 {
-  // Threads remaining lock
-  m_AppliedThreadCountLock.acquire();
-  m_AppliedThreadsRemaining--;
-  if(m_AppliedThreadsRemaining <= 0)
+  batch->m_CompletedCount++;
+  emit dataFilterApplied(batch->m_CompletedCount);
+
+  if(batch->m_CompletedCount >= static_cast<int>(batch->m_Tasks.size()))
   {
-    m_AppliedThreadCountLock.release();
-
-    for(VSSIMPLDataContainerFilter* filter : m_AppliedDataFilters)
-    {
-      auto currentFilters = m_Controller->getFilterModel()->getAllFilters();
-      bool filterFound = (std::find(currentFilters.begin(), currentFilters.end(), m_DataParentFilter) != currentFilters.end());
-      if(!filterFound)
-      {
-        m_Controller->getFilterModel()->addFilter(filter, false);
-      }
-    }
-
-    m_AppliedDataFilters.clear();
+    m_ImportBatches.erase(batch->m_Id);
   }
-  m_AppliedThreadCountLock.release();
 }
@@ -36,11 +36,13 @@
 #pragma once
 
 #include <list>
+#include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
-#include <QtCore/QFutureWatcher>
-#include <QtCore/QSemaphore>
-#include <QtCore/QThread>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QObject>
 
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 
@@ -54,6 +56,10 @@ class VSController;
 /**
  * @class VSConcurrentImport VSConcurrentImport.h SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h
  * @brief This class handles the multithreaded import process for VSSIMPLDataContainerFilters.
+ * Each DataContainer is imported as its own chain of tasks: the geometry is wrapped on a worker
+ * thread, the VSSIMPLDataContainerFilter is created on the main thread, and the wrapping is finished
+ * on a worker thread.  A DataContainer only waits on its own previous task, so filters are shown as
+ * soon as they are ready instead of waiting for every other DataContainer.
  */
 class SIMPLVtkLib_EXPORT VSConcurrentImport : public QObject
 {
@@ -70,7 +76,6 @@ public:
     SemiReload
   };
 
-
   /**
    * @brief Constructor
    * @param parent
@@ -110,33 +115,65 @@ public:
    */
   void addDataContainerArray(VSFileNameFilter* fileFilter, DataContainerArrayShPtrType dca);
 
+  /**
+   * @brief Add a DataContainerArray read from the given file filter's .dream3d file without its
+   * array values.  Its DataContainers are imported evicted and read again when a view needs them.
+   * @param fileFilter
+   * @param dca
+   */
+  void addEvictedDataContainerArray(VSFileNameFilter* fileFilter, DataContainerArrayShPtrType dca);
+
   /**
    * @brief Performs the import process on as many threads as are available.
-   * This process is performed one file path at a time, meaning that many small files will
-   * be slower to import than a single large file if the amount of data is the same.
+   * The DataContainers from every queued DataContainerArray are imported as a single batch
+   * so that worker threads are not left idle between files.
    */
   void run();
 
 signals:
   void importedFilter(VSAbstractFilter* filter, bool currentFilter = false);
-  void blockRender(bool block = true);
   void applyingDataFilters(int count);
   void dataFilterApplied(int num);
-  void finishedPartialWrapping();
-  void finishedApplying();
+  void dataContainerWrapped(int batchId, int taskIndex);
+  void dataFilterFinished(int batchId, int taskIndex);
 
 protected slots:
   /**
-   * @brief partialWrappingThreadFinished
+   * @brief Creates the VSSIMPLDataContainerFilter for a wrapped DataContainer and schedules
+   * the rest of its wrapping.  This is called on the main thread.
+   * @param batchId
+   * @param taskIndex
    */
-  void partialWrappingThreadFinished();
+  void createDataFilter(int batchId, int taskIndex);
 
   /**
-   * @brief applyDataFiltersThreadFinished
+   * @brief Updates the import progress after a VSSIMPLDataContainerFilter finished wrapping.
+   * This is called on the main thread.
+   * @param batchId
+   * @param taskIndex
    */
-  void applyDataFiltersThreadFinished();
+  void updateImportProgress(int batchId, int taskIndex);
 
 protected:
+  struct ImportTask
+  {
+    DataContainerShPtrType m_DataContainer = nullptr;
+    VSTextFilter* m_ParentFilter = nullptr;
+    SIMPLVtkBridge::WrappedDataContainerPtr m_WrappedDc = nullptr;
+    VSSIMPLDataContainerFilter* m_Filter = nullptr;
+    bool m_Evicted = false;
+  };
+
+  struct ImportBatch
+  {
+    int m_Id = 0;
+    std::vector<ImportTask> m_Tasks;
+    QAtomicInt m_NextWrapIndex;
+    int m_CompletedCount = 0;
+  };
+
+  using ImportBatchPtr = std::shared_ptr<ImportBatch>;
+
   /**
    * @brief Adds the DcaFilePair value to the list of files and DataContainerArrays to wrap
    * @param wrappedFileDc
@@ -144,42 +181,38 @@ protected:
   void addDataContainerArray(DcaGenericPair wrappedInputDc);
 
   /**
-   * @brief Begins importing the given DataContainerArray and parent filter pair
+   * @brief Adds the parent filter to the filter model and appends an ImportTask to the batch for each DataContainer
    * @param dcaPair
+   * @param batch
+   * @param evicted
+   */
+  void importDataContainerArray(DcaGenericPair dcaPair, const ImportBatchPtr& batch, bool evicted);
+
+  /**
+   * @brief Wraps DataContainer geometries from the given batch until no unclaimed DataContainers remain.
+   * Tasks are claimed through an atomic index instead of a locked queue.
+   * @param batch
    */
-  void importDataContainerArray(DcaGenericPair dcaPair);
+  void wrapDataContainers(ImportBatchPtr batch);
 
   /**
-   * @brief Wraps the DataContainers in vtkDataSets and prepares to add the generated filters to the filter model
+   * @brief Finishes wrapping the VSSIMPLDataContainerFilter for the given task
+   * @param batch
+   * @param taskIndex
    */
-  void wrapDataContainer();
+  void finishDataFilter(ImportBatchPtr batch, int taskIndex);
 
   /**
-   * @brief Applies the unapplied DataContainer filters to finish the import process.
+   * @brief Marks the given task as complete and releases the batch once every task has completed
+   * @param batch
    */
-  void applyDataFilters();
+  void completeTask(const ImportBatchPtr& batch);
 
 private:
   VSController* m_Controller;
   std::list<DcaGenericPair> m_WrappedList;
-  std::vector<VSSIMPLDataContainerFilter*> m_UnappliedDataFilters;
-  std::vector<VSSIMPLDataContainerFilter*> m_AppliedDataFilters;
-
-  DataContainerArray::Container m_ImportDataContainerQueue;
-  QMap<DataContainer::Pointer, int> m_DataContainerIndexMap;
-  QSemaphore m_ImportDataContainerOrderLock;
-  QSemaphore m_UnappliedDataFilterLock;
-  QSemaphore m_AppliedDataFilterLock;
-  QSemaphore m_FilterLock;
-  QSemaphore m_WrappedDcLock;
-  QSemaphore m_PartialWrappingThreadCountLock;
-  QSemaphore m_AppliedThreadCountLock;
-  QSemaphore m_AppliedFilterCountLock;
-  int m_NumOfFinishedImportDataContainerThreads = 0;
-  std::vector<SIMPLVtkBridge::WrappedDataContainerPtr> m_WrappedDataContainers;
-  VSTextFilter* m_DataParentFilter = nullptr;
+  std::list<DcaGenericPair> m_EvictedList;
+  std::map<int, ImportBatchPtr> m_ImportBatches;
+  int m_NextBatchId = 0;
   int m_ThreadCount;
-  int m_AppliedThreadsRemaining = 0;
-  int m_PartialWrappingThreadsRemaining = 0;
-  int m_AppliedFilterCount = 0;
 };
@@ -84,7 +84,6 @@ VSController::VSController(QObject* parent)
   connect(m_FilterModel, &VSFilterModel::filterRemoved, this, &VSController::filterRemoved);
 
   // VSConcurrentImport works on another thread, so use the old-style connections to forward signals on the current thread
-  connect(m_ImportObject, SIGNAL(blockRender(bool)), this, SIGNAL(blockRender(bool)));
   connect(m_ImportObject, SIGNAL(applyingDataFilters(int)), this, SIGNAL(applyingDataFilters(int)));
   connect(m_ImportObject, SIGNAL(dataFilterApplied(int)), this, SIGNAL(dataFilterApplied(int)));
 }
@@ -115,6 +114,17 @@ void VSController::importDataContainerArray(VSFileNameFilter* fileFilter, const
   m_ImportObject->run();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSController::importDataContainerArray(const QString &filePath, const DataContainerArray::Pointer &dca, const DataContainerArray::Pointer &evictedDca)
+{
+  VSFileNameFilter* fileFilter = new VSFileNameFilter(filePath);
+  m_ImportObject->addDataContainerArray(fileFilter, dca);
+  m_ImportObject->addEvictedDataContainerArray(fileFilter, evictedDca);
+  m_ImportObject->run();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -293,7 +303,8 @@ bool VSController::saveAsDREAM3D(const QString& outputFilePath, VSAbstractFilter
         DataContainer::Pointer dataContainer = dcFilter->getWrappedDataContainer()->m_DataContainer;
         if(dataContainer != nullptr)
         {
-          double* pos = dcFilter->getTransform()->getLocalPosition();
+          double pos[3];
+          dcFilter->getTransform()->getLocalPosition(pos);
           ImageGeom::Pointer geom = dataContainer->getGeometryAs<ImageGeom>();
           geom->setOrigin(pos[0], pos[1], pos[2]);
           dca->addOrReplaceDataContainer(dataContainer);
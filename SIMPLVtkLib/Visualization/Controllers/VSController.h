@@ -125,6 +125,17 @@ public:
    */
   void importDataContainerArray(VSFileNameFilter *fileFilter, const DataContainerArray::Pointer &dca);
 
+  /**
+   * @brief Import data from a DataContainerArray and add any relevant DataContainers
+   * as top-level VisualFilters.  The DataContainers in evictedDca were read without
+   * their array values and are imported evicted so that their arrays are only read
+   * from the file when a view streaming montage tiles needs them.
+   * @param filePath
+   * @param dca
+   * @param evictedDca
+   */
+  void importDataContainerArray(const QString &filePath, const DataContainerArray::Pointer &dca, const DataContainerArray::Pointer &evictedDca);
+
   /**
    * @brief Import data from a FilterPipeline and add any relevant DataContainers as top-level VisualFilters
    * @param pipeline
@@ -187,7 +198,6 @@ signals:
   void filterAdded(VSAbstractFilter*, bool currentFilter);
   void filterRemoved(VSAbstractFilter*);
   void filterCheckStateChanged(VSAbstractFilter* filter);
-  void blockRender(bool block);
   void dataImported();
   // void filterSelected(VSAbstractFilter* filter);
   void applyingDataFilters(int count);
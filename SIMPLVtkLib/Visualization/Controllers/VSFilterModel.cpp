@@ -365,7 +365,7 @@ QModelIndex VSFilterModel::index(int row, int column, const QModelIndex& parent)
   if(parent.isValid())
   {
     VSAbstractFilter* parentFilter = getFilterFromIndex(parent);
-    if(parentFilter && row < parentFilter->getChildren().size())
+    if(parentFilter && row < parentFilter->getChildCount())
     {
       return createIndex(row, column, parentFilter->getChild(row));
     }
@@ -407,7 +407,7 @@ int VSFilterModel::rowCount(const QModelIndex& parent) const
   VSAbstractFilter* filter = getFilterFromIndex(parent);
   if(filter)
   {
-    return filter->getChildren().size();
+    return filter->getChildCount();
   }
 
   return 0;
@@ -436,9 +436,33 @@ void VSFilterModel::beginInsertingFilter(VSAbstractFilter* parentFilter)
 void VSFilterModel::endInsertingFilter(VSAbstractFilter* filter)
 {
   endInsertRows();
+
+  if(filter)
+  {
+    connect(filter, &VSAbstractFilter::filterNameChanged, this, &VSFilterModel::filterTextChanged, Qt::UniqueConnection);
+  }
+
   emit finishedInsertingFilter();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterModel::filterTextChanged()
+{
+  VSAbstractFilter* filter = dynamic_cast<VSAbstractFilter*>(sender());
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  QModelIndex index = getIndexFromFilter(filter);
+  if(index.isValid())
+  {
+    emit dataChanged(index, index, QVector<int>{Qt::DisplayRole});
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -269,6 +269,11 @@ private slots:
    */
   void deleteFilter(VSAbstractFilter* filter);
 
+  /**
+   * @brief Notifies views that the sending filter's display text changed
+   */
+  void filterTextChanged();
+
 private:
   QSemaphore m_ModelLock;
   VSRootFilter* m_RootFilter = nullptr;
@@ -458,7 +458,7 @@ QModelIndex VSFilterViewModel::index(int row, int column, const QModelIndex& par
     if(parent.isValid())
     {
       VSAbstractFilter* parentFilter = getFilterFromIndex(parent);
-      if(parentFilter && row < parentFilter->getChildren().size())
+      if(parentFilter && row < parentFilter->getChildCount())
       {
         return createIndex(row, column, parentFilter->getChild(row));
       }
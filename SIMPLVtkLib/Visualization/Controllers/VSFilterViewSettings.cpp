@@ -35,6 +35,10 @@
 
 #include "VSFilterViewSettings.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include <QtConcurrent>
 #include <QtWidgets/QColorDialog>
 #include <QtWidgets/QInputDialog>
 
@@ -51,10 +55,13 @@
 #include <vtkMapper.h>
 #include <vtkPlaneSource.h>
 #include <vtkPointData.h>
+#include <vtkPolyData.h>
 #include <vtkProperty.h>
+#include <vtkRenderer.h>
 #include <vtkTextProperty.h>
 #include <vtkTexture.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
 
@@ -141,6 +148,15 @@ VSFilterViewSettings::VSFilterViewSettings(const VSFilterViewSettings& copy)
 // -----------------------------------------------------------------------------
 VSFilterViewSettings::~VSFilterViewSettings()
 {
+  // Cached textures reference the image pyramid and the SIMPLib backed arrays
+  m_Texture = nullptr;
+  if(vtkActor* actor = getDataSetActor())
+  {
+    actor->SetTexture(nullptr);
+  }
+  VSTextureCache::Instance()->releaseTexture(m_TextureKey);
+  VSTextureCache::Instance()->releaseTexture(m_ReplacedTextureKey);
+
   if(m_LookupTable)
   {
     delete m_LookupTable;
@@ -452,8 +468,7 @@ int VSFilterViewSettings::getNumberOfComponents(QString arrayName)
 
   if(isPointData())
   {
-    vtkPointData* pointData = m_Filter->getOutput()->GetPointData();
-    array = pointData->GetAbstractArray(qPrintable(arrayName));
+    array = m_Filter->getPointDataArray(arrayName);
   }
   else
   {
@@ -565,7 +580,7 @@ void VSFilterViewSettings::setIsSelected(bool selected)
     actor->SetPosition(actor->GetPosition()[0], actor->GetPosition()[1], actor->GetPosition()[2] - 1.0);
   }
 
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -627,6 +642,19 @@ vtkActor* VSFilterViewSettings::getImageActor() const
   return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkTexture) VSFilterViewSettings::getTexture() const
+{
+  if(ActorType::Image2D != m_ActorType)
+  {
+    return nullptr;
+  }
+
+  return m_Texture;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -750,10 +778,8 @@ vtkDataArray* VSFilterViewSettings::getArrayByName(QString name) const
 
   if(isPointData())
   {
-    if(dataSet->GetPointData())
-    {
-      return dataSet->GetPointData()->GetArray(qPrintable(name));
-    }
+    // Point arrays may need to be interpolated from cell data first
+    return m_Filter->getPointDataArray(name);
   }
   else
   {
@@ -792,7 +818,7 @@ void VSFilterViewSettings::setActiveArrayName(QString name)
 
     emit activeArrayNameChanged(m_ActiveArrayName);
     emit componentNamesChanged();
-    emit requiresRender();
+    requestRender();
 
     updateScalarBarVisibility();
     updateTexture();
@@ -860,30 +886,40 @@ void VSFilterViewSettings::setActiveComponentIndex(int index)
   mapper->ColorByArrayComponent(qPrintable(m_ActiveArrayName), index);
   updateColorMode();
 
-  // Set ScalarBar title
+  // Set ScalarBar title.  The current lookup table range is kept if the array statistics
+  // cannot provide a range for the component.
+  double range[2];
   if(numComponents == 1)
   {
-    double* range = dataArray->GetRange();
-    m_LookupTable->setRange(range);
+    if(VSArrayStatistics::Instance()->getRange(dataArray, 0, range))
+    {
+      m_LookupTable->setRange(range);
+    }
     m_ScalarBarActor->SetTitle(dataArray->GetName());
   }
   else if(index == -1)
   {
-    double* range = dataArray->GetRange(-1);
     QString dataArrayName = QString(dataArray->GetName());
     QString componentName = dataArrayName + " Magnitude";
 
-    m_LookupTable->setRange(range);
+    if(VSArrayStatistics::Instance()->getRange(dataArray, -1, range))
+    {
+      m_LookupTable->setRange(range);
+    }
     m_ScalarBarActor->SetTitle(qPrintable(componentName));
-    updateTexture();
   }
   else if(index < numComponents)
   {
-    double* range = dataArray->GetRange(index);
-    m_LookupTable->setRange(range);
+    if(VSArrayStatistics::Instance()->getRange(dataArray, index, range))
+    {
+      m_LookupTable->setRange(range);
+    }
     m_ScalarBarActor->SetTitle(dataArray->GetComponentName(index));
   }
 
+  // The lookup table range is part of the texture key
+  updateTexture();
+
   emit activeComponentIndexChanged(m_ActiveComponent);
 }
 
@@ -926,11 +962,28 @@ bool VSFilterViewSettings::isColorArray(vtkDataArray* dataArray) const
 //
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::updateColorMode()
+{
+  if(m_BatchDepth > 0)
+  {
+    m_PendingColorMode = true;
+    return;
+  }
+
+  if(applyColorMode())
+  {
+    updateTexture();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::applyColorMode()
 {
   vtkDataSetMapper* mapper = getDataSetMapper();
   if(nullptr == mapper)
   {
-    return;
+    return false;
   }
 
   vtkDataArray* dataArray = getDataArray();
@@ -948,7 +1001,7 @@ void VSFilterViewSettings::updateColorMode()
 
   mapper->Update();
   updateScalarBarVisibility();
-  updateTexture();
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -993,7 +1046,7 @@ void VSFilterViewSettings::setMapColors(ColorMapping mapColors)
 
   updateColorMode();
   emit mapColorsChanged(m_MapColors);
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1025,7 +1078,7 @@ void VSFilterViewSettings::setAlpha(double alpha)
   }
 
   emit alphaChanged(m_Alpha);
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1071,7 +1124,8 @@ void VSFilterViewSettings::invertScalarBar()
   }
 
   m_LookupTable->invert();
-  emit requiresRender();
+  updateTexture();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1085,7 +1139,8 @@ void VSFilterViewSettings::loadPresetColors(const QJsonObject& colors)
   }
 
   m_LookupTable->parseRgbJson(colors);
-  emit requiresRender();
+  updateTexture();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1185,7 +1240,7 @@ void VSFilterViewSettings::setupActors(bool outline)
   //{
   //  setRepresentation(Representation::Outline);
   //}
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1221,6 +1276,32 @@ bool VSFilterViewSettings::hasSinglePointArray()
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::isSurfaceData() const
+{
+  if(nullptr == m_Filter)
+  {
+    return false;
+  }
+
+  return nullptr != vtkPolyData::SafeDownCast(m_Filter->getOutput());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSFilterViewSettings::getSurfaceOutputPort()
+{
+  if(isSurfaceData())
+  {
+    return m_Filter->getTransformedOutputPort();
+  }
+
+  return m_DataSetFilter->GetOutputPort();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1345,9 +1426,7 @@ void VSFilterViewSettings::setupImageActors()
 
   // Save the initial transform
   VSTransform* defaultTransform = getDefaultTransform();
-  defaultTransform->setLocalPosition(m_Filter->getTransform()->getLocalPosition());
-  defaultTransform->setLocalRotation(m_Filter->getTransform()->getLocalRotation());
-  defaultTransform->setLocalScale(m_Filter->getTransform()->getLocalScale());
+  defaultTransform->setLocalValues(m_Filter->getTransform());
 
   updateTexture();
   updateTransform();
@@ -1408,7 +1487,7 @@ void VSFilterViewSettings::setupDataSetActors()
   }
   else
   {
-    mapper->SetInputConnection(m_DataSetFilter->GetOutputPort());
+    mapper->SetInputConnection(getSurfaceOutputPort());
   }
   actor->SetMapper(mapper);
 
@@ -1510,7 +1589,12 @@ void VSFilterViewSettings::updateInputPort(VSAbstractFilter* filter)
       }
     }
   }
-  emit requiresRender();
+  else if(ActorType::DataSet == m_ActorType && getRepresentation() != Representation::Outline)
+  {
+    // The output may have changed between surface and non-surface data
+    m_Mapper->SetInputConnection(getSurfaceOutputPort());
+  }
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1539,9 +1623,12 @@ void VSFilterViewSettings::updateTransform()
 
     // Get transform vectors
     VSTransform* transform = m_Filter->getTransform();
-    double* transformPosition = transform->getPosition();
-    double* transformRotation = transform->getRotation();
-    double* transformScale = transform->getScale();
+    double transformPosition[3];
+    double transformRotation[3];
+    double transformScale[3];
+    transform->getPosition(transformPosition);
+    transform->getRotation(transformRotation);
+    transform->getScale(transformScale);
 
     m_Actor->SetPosition(transformPosition);
     m_Actor->SetOrientation(transformRotation);
@@ -1566,7 +1653,7 @@ void VSFilterViewSettings::updateTransform()
     }
   }
 
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1587,6 +1674,8 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
     {
       disconnect(m_Filter, SIGNAL(dataImported()), this, SLOT(importedData()));
       disconnect(m_Filter, SIGNAL(dataReloaded()), this, SLOT(reloadedData()));
+      disconnect(m_Filter, SIGNAL(dataEvicted()), this, SLOT(evictedData()));
+      disconnect(m_Filter, SIGNAL(dataRestored()), this, SLOT(restoredData()));
     }
   }
 
@@ -1616,6 +1705,8 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
     {
       connect(filter, SIGNAL(dataImported()), this, SLOT(importedData()));
       connect(filter, SIGNAL(dataReloaded()), this, SLOT(reloadedData()));
+      connect(filter, SIGNAL(dataEvicted()), this, SLOT(evictedData()));
+      connect(filter, SIGNAL(dataRestored()), this, SLOT(restoredData()));
     }
   }
 }
@@ -1657,7 +1748,7 @@ void VSFilterViewSettings::setSolidColorPtr(double* color)
   actor->GetProperty()->SetColor(color);
 
   emit solidColorChanged();
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1746,7 +1837,7 @@ void VSFilterViewSettings::setPointSize(int pointSize)
   {
     getDataSetActor()->GetProperty()->SetPointSize(pointSize);
     emit pointSizeChanged(pointSize);
-    emit requiresRender();
+    requestRender();
   }
 }
 
@@ -1772,7 +1863,7 @@ void VSFilterViewSettings::setRenderPointsAsSpheres(bool renderSpheres)
   {
     getDataSetActor()->GetProperty()->SetRenderPointsAsSpheres(renderSpheres);
     emit renderPointSpheresChanged(renderSpheres);
-    emit requiresRender();
+    requestRender();
   }
 }
 
@@ -1816,7 +1907,7 @@ void VSFilterViewSettings::setRepresentation(const Representation& type)
     }
     else
     {
-      mapper->SetInputConnection(m_DataSetFilter->GetOutputPort());
+      mapper->SetInputConnection(getSurfaceOutputPort());
     }
 
     if(type == Representation::SurfaceWithEdges)
@@ -1843,7 +1934,7 @@ void VSFilterViewSettings::setRepresentation(const Representation& type)
   updateTransform();
   updateScalarBarVisibility();
   emit representationChanged(type);
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1874,7 +1965,7 @@ void VSFilterViewSettings::importedData()
     setRepresentation(Representation::Surface);
   }
 
-  emit requiresRender();
+  requestRender();
   emit dataLoaded();
 }
 
@@ -1884,7 +1975,7 @@ void VSFilterViewSettings::importedData()
 void VSFilterViewSettings::checkDataType()
 {
   setupActors(false);
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -1919,6 +2010,42 @@ void VSFilterViewSettings::reloadedData()
   emit dataLoaded();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::evictedData()
+{
+  // The texture and cached levels hold the only remaining references to the evicted arrays
+  VSTextureCache::Instance()->releaseDataSet(m_TextureKey.DataSet);
+  m_ImagePyramid.clear();
+  m_PyramidSource = nullptr;
+  m_Texture = nullptr;
+  m_TextureKey = VSTextureCache::Key();
+
+  vtkActor* actor = getDataSetActor();
+  if(nullptr != actor)
+  {
+    actor->SetTexture(nullptr);
+  }
+
+  vtkMapper* mapper = vtkMapper::SafeDownCast(m_Mapper);
+  if(nullptr != mapper && nullptr != m_OutlineFilter)
+  {
+    mapper->SetInputConnection(m_OutlineFilter->GetOutputPort());
+  }
+
+  requestRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::restoredData()
+{
+  // Restores follow the camera, so the replaced actors are swapped in without updating the scene
+  setupActors(false);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1951,9 +2078,10 @@ void VSFilterViewSettings::copySettings(VSFilterViewSettings* copy)
   if(hasUi && m_ScalarBarWidget)
   {
     m_LookupTable->copy(*(copy->m_LookupTable));
+    updateTexture();
   }
 
-  emit requiresRender();
+  requestRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -2133,6 +2261,116 @@ QIcon VSFilterViewSettings::GetPointDataIcon()
   return QIcon();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::requestRender()
+{
+  if(m_BatchDepth > 0)
+  {
+    m_PendingRender = true;
+    return;
+  }
+
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::BeginBatch(VSFilterViewSettings::Collection collection)
+{
+  for(VSFilterViewSettings* settings : collection)
+  {
+    settings->m_BatchDepth++;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::CommitBatch(VSFilterViewSettings::Collection collection)
+{
+  struct PendingTexture
+  {
+    VSFilterViewSettings* Settings = nullptr;
+    TextureRequest Request;
+    bool Prepared = false;
+  };
+
+  std::vector<VSFilterViewSettings*> committedSettings;
+  std::vector<PendingTexture> pendingTextures;
+  for(VSFilterViewSettings* settings : collection)
+  {
+    if(settings->m_BatchDepth <= 0 || --settings->m_BatchDepth > 0)
+    {
+      continue;
+    }
+    committedSettings.push_back(settings);
+
+    // Pipeline updates happen once per settings regardless of how many properties changed
+    if(settings->m_PendingColorMode)
+    {
+      settings->m_PendingColorMode = false;
+      if(settings->applyColorMode())
+      {
+        settings->m_PendingTexture = true;
+      }
+    }
+    if(settings->m_PendingTexture)
+    {
+      settings->m_PendingTexture = false;
+      PendingTexture pendingTexture;
+      pendingTexture.Settings = settings;
+      pendingTextures.push_back(pendingTexture);
+    }
+  }
+
+  // Settings displaying the same image pass their pyramid along so that each level is
+  // extracted once.  vtkExtractVOI reads the shared source image, so this stays on this thread.
+  std::map<vtkImageData*, VSFilterViewSettings*> pyramidSettings;
+  for(PendingTexture& pendingTexture : pendingTextures)
+  {
+    VSFilterViewSettings* settings = pendingTexture.Settings;
+    vtkImageData* sourceImage = vtkImageData::SafeDownCast(settings->m_Filter->getOutput());
+    if(nullptr != sourceImage)
+    {
+      auto iter = pyramidSettings.find(sourceImage);
+      if(iter != pyramidSettings.end())
+      {
+        settings->shareImagePyramid(iter->second);
+      }
+      pyramidSettings[sourceImage] = settings;
+    }
+    pendingTexture.Prepared = settings->requestTexture(pendingTexture.Request);
+  }
+
+  // VSTextureCache is thread safe
+  QtConcurrent::blockingMap(pendingTextures, [](PendingTexture& pendingTexture) {
+    if(pendingTexture.Prepared)
+    {
+      pendingTexture.Prepared = pendingTexture.Settings->prepareTexture(pendingTexture.Request);
+    }
+  });
+  for(const PendingTexture& pendingTexture : pendingTextures)
+  {
+    if(pendingTexture.Prepared)
+    {
+      pendingTexture.Settings->applyTexture();
+    }
+  }
+
+  // Views coalesce the render requests into a single render
+  for(VSFilterViewSettings* settings : committedSettings)
+  {
+    if(settings->m_PendingRender)
+    {
+      settings->m_PendingRender = false;
+      emit settings->requiresRender();
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -2154,10 +2392,12 @@ int VSFilterViewSettings::GetPointSize(VSFilterViewSettings::Collection collecti
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetPointSize(VSFilterViewSettings::Collection collection, int size)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setPointSize(size);
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2217,10 +2457,12 @@ Qt::CheckState VSFilterViewSettings::IsRenderingPointsAsSpheres(VSFilterViewSett
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetRenderPointsAsSpheres(VSFilterViewSettings::Collection collection, bool renderSpheres)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setRenderPointsAsSpheres(renderSpheres);
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2254,10 +2496,12 @@ Qt::CheckState VSFilterViewSettings::IsGridVisible(VSFilterViewSettings::Collect
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetGridVisible(VSFilterViewSettings::Collection collection, bool visible)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setGridVisible(visible);
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2410,10 +2654,12 @@ QString VSFilterViewSettings::GetActiveArrayName(VSFilterViewSettings::Collectio
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetActiveArrayName(VSFilterViewSettings::Collection collection, QString arrayName)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setActiveArrayName(arrayName);
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2459,10 +2705,12 @@ void VSFilterViewSettings::SetActiveComponentIndex(VSFilterViewSettings::Collect
     return;
   }
 
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setActiveComponentIndex(index);
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2470,6 +2718,7 @@ void VSFilterViewSettings::SetActiveComponentIndex(VSFilterViewSettings::Collect
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetSubsampling(VSFilterViewSettings::Collection collection, int value)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     if(settings->isVisible())
@@ -2477,6 +2726,7 @@ void VSFilterViewSettings::SetSubsampling(VSFilterViewSettings::Collection colle
       settings->setSubsampling(value);
     }
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2484,11 +2734,102 @@ void VSFilterViewSettings::SetSubsampling(VSFilterViewSettings::Collection colle
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::setSubsampling(int value)
 {
+  if(value < 1)
+  {
+    value = 1;
+  }
+  if(m_Subsampling == value)
+  {
+    return;
+  }
+
   m_Subsampling = value;
   updateTexture();
   emit subsamplingChanged(value);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updateLevelOfDetail(vtkRenderer* renderer)
+{
+  if(nullptr == renderer || nullptr == m_Actor || !isFlatImage())
+  {
+    return;
+  }
+
+  VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
+  vtkImageData* imageData = dynamic_cast<vtkImageData*>(outputData.Get());
+  if(nullptr == imageData)
+  {
+    return;
+  }
+
+  int dims[3];
+  imageData->GetDimensions(dims);
+
+  // Coarsest level that still leaves at least two samples along each flat axis
+  int maxRate = 1;
+  while(true)
+  {
+    bool canSubsample = true;
+    for(int i = 0; i < 3; i++)
+    {
+      if(dims[i] > 1 && dims[i] / (maxRate * 2) < 2)
+      {
+        canSubsample = false;
+      }
+    }
+    if(!canSubsample)
+    {
+      break;
+    }
+    maxRate *= 2;
+  }
+
+  double* bounds = m_Actor->GetBounds();
+  if(nullptr == bounds)
+  {
+    return;
+  }
+
+  // Project the actor bounds into display coordinates
+  double displayMin[2] = {VTK_DOUBLE_MAX, VTK_DOUBLE_MAX};
+  double displayMax[2] = {VTK_DOUBLE_MIN, VTK_DOUBLE_MIN};
+  for(int corner = 0; corner < 8; corner++)
+  {
+    renderer->SetWorldPoint(bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)], bounds[4 + ((corner >> 2) & 1)], 1.0);
+    renderer->WorldToDisplay();
+    double* displayPoint = renderer->GetDisplayPoint();
+    for(int i = 0; i < 2; i++)
+    {
+      displayMin[i] = std::min(displayMin[i], displayPoint[i]);
+      displayMax[i] = std::max(displayMax[i], displayPoint[i]);
+    }
+  }
+
+  int rate = maxRate;
+  int* viewSize = renderer->GetSize();
+  bool onScreen = displayMax[0] >= 0.0 && displayMax[1] >= 0.0 && displayMin[0] <= viewSize[0] && displayMin[1] <= viewSize[1];
+  if(onScreen)
+  {
+    // Compare the image diagonal in samples against the projected diagonal in pixels
+    double pixelWidth = displayMax[0] - displayMin[0];
+    double pixelHeight = displayMax[1] - displayMin[1];
+    double pixelDiagonal = std::max(std::sqrt(pixelWidth * pixelWidth + pixelHeight * pixelHeight), 1.0);
+    double sampleDiagonal = std::sqrt(static_cast<double>(dims[0]) * dims[0] + static_cast<double>(dims[1]) * dims[1] + static_cast<double>(dims[2]) * dims[2]);
+    double samplesPerPixel = sampleDiagonal / pixelDiagonal;
+
+    rate = 1;
+    while(rate < maxRate && rate * 2 <= samplesPerPixel)
+    {
+      rate *= 2;
+    }
+  }
+
+  setSubsampling(rate);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -2630,10 +2971,12 @@ int VSFilterViewSettings::GetRepresentationi(VSFilterViewSettings::Collection co
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetRepresentation(VSFilterViewSettings::Collection collection, Representation rep)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setRepresentation(rep);
   }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2641,10 +2984,77 @@ void VSFilterViewSettings::SetRepresentation(VSFilterViewSettings::Collection co
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::SetSolidColor(VSFilterViewSettings::Collection collection, QColor color)
 {
+  BeginBatch(collection);
   for(VSFilterViewSettings* settings : collection)
   {
     settings->setSolidColor(color);
   }
+  CommitBatch(collection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::SetMapColors(VSFilterViewSettings::Collection collection, ColorMapping mapColors)
+{
+  BeginBatch(collection);
+  for(VSFilterViewSettings* settings : collection)
+  {
+    settings->setMapColors(mapColors);
+  }
+  CommitBatch(collection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::SetAlpha(VSFilterViewSettings::Collection collection, double alpha)
+{
+  BeginBatch(collection);
+  for(VSFilterViewSettings* settings : collection)
+  {
+    settings->setAlpha(alpha);
+  }
+  CommitBatch(collection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::SetScalarBarSetting(VSFilterViewSettings::Collection collection, ScalarBarSetting setting)
+{
+  BeginBatch(collection);
+  for(VSFilterViewSettings* settings : collection)
+  {
+    settings->setScalarBarSetting(setting);
+  }
+  CommitBatch(collection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::LoadPresetColors(VSFilterViewSettings::Collection collection, const QJsonObject& colors)
+{
+  BeginBatch(collection);
+  for(VSFilterViewSettings* settings : collection)
+  {
+    settings->loadPresetColors(colors);
+  }
+  CommitBatch(collection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::InvertScalarBar(VSFilterViewSettings::Collection collection)
+{
+  BeginBatch(collection);
+  for(VSFilterViewSettings* settings : collection)
+  {
+    settings->invertScalarBar();
+  }
+  CommitBatch(collection);
 }
 
 // -----------------------------------------------------------------------------
@@ -2797,35 +3207,72 @@ int VSFilterViewSettings::getSubsampling() const
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::updateTexture()
 {
-  if(!isFlatImage())
+  if(m_BatchDepth > 0)
   {
+    m_PendingTexture = true;
     return;
   }
-  VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
-  vtkImageData* imageData = dynamic_cast<vtkImageData*>(outputData.Get());
 
-  VTK_PTR(vtkTexture) texture = VTK_PTR(vtkTexture)::New();
+  TextureRequest request;
+  if(requestTexture(request) && prepareTexture(request))
+  {
+    applyTexture();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::requestTexture(TextureRequest& request)
+{
+  if(!isFlatImage())
+  {
+    return false;
+  }
 
-  texture->InterpolateOn();
-  texture->SetInputData(imageData);
-  if(m_LookupTable != nullptr)
+  request.SourceImage = vtkImageData::SafeDownCast(m_Filter->getOutput());
+  if(nullptr == request.SourceImage)
   {
-    texture->SetLookupTable(m_LookupTable->getColorTransferFunction());
+    return false;
   }
 
-  if(m_Subsampling > 1)
+  bool unmapColorArray = isColorArray(getDataArray()) && (m_ActiveComponent == -1);
+  request.MapColors = (ColorMapping::NonColors == m_MapColors && !unmapColorArray) || ColorMapping::Always == m_MapColors;
+  request.Image = getSubsampledImage(m_Subsampling);
+  return nullptr != request.Image;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::prepareTexture(const TextureRequest& request)
+{
+  if(nullptr == request.SourceImage || nullptr == request.Image)
   {
-    VTK_PTR(vtkExtractVOI) subsample = VTK_PTR(vtkExtractVOI)::New();
-    int* inputDims = imageData->GetDimensions();
-    subsample->SetInputData(imageData);
-    subsample->SetSampleRate(m_Subsampling, m_Subsampling, m_Subsampling);
-    subsample->Update();
+    return false;
+  }
 
-    vtkImageData* extracted = subsample->GetOutput();
-    texture->SetInputData(extracted);
+  vtkColorTransferFunction* lookupTable = (m_LookupTable != nullptr) ? m_LookupTable->getColorTransferFunction().Get() : nullptr;
+  VSTextureCache::Key key = VSTextureCache::CreateKey(request.SourceImage, m_ActiveArrayName, m_ActiveComponent, m_Subsampling, request.MapColors, lookupTable);
+  if(nullptr == m_Texture || key != m_TextureKey)
+  {
+    // The replaced texture is released once the actor stops using it in applyTexture
+    if(nullptr == m_ReplacedTextureKey.DataSet)
+    {
+      m_ReplacedTextureKey = m_TextureKey;
+    }
+    m_Texture = VSTextureCache::Instance()->getTexture(key, request.Image, lookupTable);
+    m_TextureKey = key;
   }
 
-  m_Texture = texture;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::applyTexture()
+{
   vtkActor* actor = getDataSetActor();
   if(nullptr != actor)
   {
@@ -2838,6 +3285,84 @@ void VSFilterViewSettings::updateTexture()
       actor->GetProperty()->RemoveAllTextures();
     }
   }
+
+  if(m_ReplacedTextureKey != m_TextureKey)
+  {
+    VSTextureCache::Instance()->releaseTexture(m_ReplacedTextureKey);
+  }
+  m_ReplacedTextureKey = VSTextureCache::Key();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkImageData* VSFilterViewSettings::getSubsampledImage(int rate)
+{
+  VTK_PTR(vtkDataSet) outputData = m_Filter->getOutput();
+  vtkImageData* imageData = dynamic_cast<vtkImageData*>(outputData.Get());
+  if(nullptr == imageData)
+  {
+    m_ImagePyramid.clear();
+    m_PyramidSource = nullptr;
+    return nullptr;
+  }
+
+  // Drop cached levels when the filter output has been replaced or modified
+  if(m_PyramidSource != imageData || m_PyramidMTime != imageData->GetMTime())
+  {
+    m_ImagePyramid.clear();
+    m_PyramidSource = imageData;
+    m_PyramidMTime = imageData->GetMTime();
+  }
+
+  if(rate <= 1)
+  {
+    return imageData;
+  }
+
+  auto iter = m_ImagePyramid.find(rate);
+  if(iter != m_ImagePyramid.end())
+  {
+    return iter->second;
+  }
+
+  vtkImageData* sourceImage = imageData;
+  int sampleRate = rate;
+  if((rate & (rate - 1)) == 0)
+  {
+    sourceImage = getSubsampledImage(rate / 2);
+    sampleRate = 2;
+  }
+
+  VTK_PTR(vtkExtractVOI) subsample = VTK_PTR(vtkExtractVOI)::New();
+  subsample->SetInputData(sourceImage);
+  subsample->SetSampleRate(sampleRate, sampleRate, sampleRate);
+  subsample->Update();
+
+  VTK_PTR(vtkImageData) level = VTK_PTR(vtkImageData)::New();
+  level->ShallowCopy(subsample->GetOutput());
+  m_ImagePyramid[rate] = level;
+  return level;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::shareImagePyramid(const VSFilterViewSettings* other)
+{
+  if(nullptr == other || nullptr == other->m_PyramidSource)
+  {
+    return;
+  }
+
+  // getSubsampledImage drops the shared levels if the image was modified since they were extracted
+  if(m_PyramidSource != other->m_PyramidSource || m_PyramidMTime != other->m_PyramidMTime)
+  {
+    m_ImagePyramid.clear();
+    m_PyramidSource = other->m_PyramidSource;
+    m_PyramidMTime = other->m_PyramidMTime;
+  }
+  m_ImagePyramid.insert(other->m_ImagePyramid.begin(), other->m_ImagePyramid.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -48,6 +48,7 @@
 #include <vtkActor.h>
 #include <vtkCubeAxesActor.h>
 #include <vtkDataSetSurfaceFilter.h>
+#include <vtkImageData.h>
 #include <vtkOutlineFilter.h>
 #include <vtkPlaneSource.h>
 #include <vtkScalarBarActor.h>
@@ -56,11 +57,13 @@
 
 #include "SIMPLVtkLib/Dialogs/AbstractImportMontageDialog.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSTextureCache.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 class vtkDataSetMapper;
+class vtkRenderer;
 class vtkImageSliceMapper;
 class vtkImageSlice;
 
@@ -312,6 +315,13 @@ public:
    */
   VTK_PTR(vtkProp3D) getActor();
 
+  /**
+   * @brief Returns the texture displayed on flat images.  Returns nullptr if the
+   * filter is not displayed as a flat image.
+   * @return
+   */
+  VTK_PTR(vtkTexture) getTexture() const;
+
   /**
    * @brief Returns the vtkScalarBarWidget used for the filter
    * @return
@@ -446,6 +456,14 @@ public:
    */
   int getSubsampling() const;
 
+  /**
+   * @brief Selects the subsampling level for flat images based on the number of
+   * screen pixels the image currently covers in the given renderer.  Levels are
+   * powers of two and are cached so that switching levels does not re-extract the image.
+   * @param renderer
+   */
+  void updateLevelOfDetail(vtkRenderer* renderer);
+
   /**
    * @brief Set the display type
    * @param displayType
@@ -496,6 +514,23 @@ public:
   /////////////////
   // Collections //
   /////////////////
+  /**
+   * @brief Opens a batch update for all items in the collection.  While a batch is
+   * open, color mode, texture, and render updates are deferred until CommitBatch is
+   * called.  Batches can be nested.
+   * @param collection
+   */
+  static void BeginBatch(VSFilterViewSettings::Collection collection);
+
+  /**
+   * @brief Closes the batch update for all items in the collection.  Items leaving
+   * their outermost batch update their color mode once, rebuild their textures, and
+   * request a single render.  Subsampled images are extracted once per source image
+   * and only the texture lookups run in parallel.
+   * @param collection
+   */
+  static void CommitBatch(VSFilterViewSettings::Collection collection);
+
   /**
    * @brief Returns a QStringList of all shared array names in the given collection
    * @param collection
@@ -665,6 +700,40 @@ public:
    */
   static void SetSolidColor(VSFilterViewSettings::Collection collection, QColor color);
 
+  /**
+   * @brief Sets the color mapping for all items in the collection.
+   * @param collection
+   * @param mapColors
+   */
+  static void SetMapColors(VSFilterViewSettings::Collection collection, ColorMapping mapColors);
+
+  /**
+   * @brief Sets the alpha transparency for all items in the collection.
+   * @param collection
+   * @param alpha
+   */
+  static void SetAlpha(VSFilterViewSettings::Collection collection, double alpha);
+
+  /**
+   * @brief Sets the ScalarBarSetting for all items in the collection.
+   * @param collection
+   * @param setting
+   */
+  static void SetScalarBarSetting(VSFilterViewSettings::Collection collection, ScalarBarSetting setting);
+
+  /**
+   * @brief Loads the preset colors for all items in the collection.
+   * @param collection
+   * @param colors
+   */
+  static void LoadPresetColors(VSFilterViewSettings::Collection collection, const QJsonObject& colors);
+
+  /**
+   * @brief Inverts the scalar bar for all items in the collection.
+   * @param collection
+   */
+  static void InvertScalarBar(VSFilterViewSettings::Collection collection);
+
   /**
    * @brief Returns the ActorType for all valid items in the collection.  Returns Invalid if multiple types are found.
    * @param collection
@@ -790,6 +859,16 @@ public slots:
    */
   void reloadedData();
 
+  /**
+   * @brief Releases references to the evicted data and displays an outline in its place
+   */
+  void evictedData();
+
+  /**
+   * @brief Rebuilds the actors once evicted data has been read back into memory
+   */
+  void restoredData();
+
   /**
    * @brief Updates the actors for the current data type and renders the changes
    */
@@ -909,6 +988,20 @@ protected:
    */
   bool hasSinglePointArray();
 
+  /**
+   * @brief Returns true if the filter output is already a vtkPolyData surface and can be
+   * passed to the mapper without vtkDataSetSurfaceFilter.  Returns false otherwise.
+   * @return
+   */
+  bool isSurfaceData() const;
+
+  /**
+   * @brief Returns the output port providing the surface to render.  Surface data uses the
+   * transformed output directly while other data is passed through vtkDataSetSurfaceFilter.
+   * @return
+   */
+  vtkAlgorithmOutput* getSurfaceOutputPort();
+
   /**
    * @brief Updates the alpha for DataSet actors
    */
@@ -952,10 +1045,23 @@ protected:
   vtkDataArray* getArrayByName(QString name) const;
 
   /**
-   * @brief Updates the mapper color mode to match variable values
+   * @brief Updates the mapper color mode to match variable values.  The update is
+   * deferred until the batch is committed if a batch update is open.
    */
   void updateColorMode();
 
+  /**
+   * @brief Applies the color mode to the vtkDataSetMapper.  Returns false if there
+   * is no vtkDataSetMapper to update.
+   * @return
+   */
+  bool applyColorMode();
+
+  /**
+   * @brief Emits requiresRender or marks a render as pending if a batch update is open
+   */
+  void requestRender();
+
   /**
    * @brief Returns true if colors are mapped. Returns false otherwise.
    * @return
@@ -991,10 +1097,60 @@ protected:
   void setSubsampling(int value);
 
   /**
-   * @brief Update the texture
+   * @brief Updates the texture from the shared VSTextureCache.  The texture is
+   * only replaced when the image, array, component, subsampling, color mode, or
+   * lookup table changed since the last update.
    */
   void updateTexture();
 
+  struct TextureRequest
+  {
+    vtkImageData* SourceImage = nullptr;
+    vtkImageData* Image = nullptr;
+    bool MapColors = true;
+  };
+
+  /**
+   * @brief Collects the images and color mode the texture for the current settings
+   * is created from.  This reads the filter output and extracts any missing levels of
+   * the image pyramid, so it must not be called for several settings in parallel.
+   * Returns false if there is no texture to apply.
+   * @param request
+   * @return
+   */
+  bool requestTexture(TextureRequest& request);
+
+  /**
+   * @brief Finds or creates the texture for the given request without modifying the
+   * actor or reading the filter.  This only uses the shared VSTextureCache so it can
+   * be called for several settings in parallel.  Returns false if there is no texture
+   * to apply.
+   * @param request
+   * @return
+   */
+  bool prepareTexture(const TextureRequest& request);
+
+  /**
+   * @brief Applies the prepared texture to the actor
+   */
+  void applyTexture();
+
+  /**
+   * @brief Returns the flat image subsampled by the given rate.  Subsampled images are
+   * cached until the filter output changes.  Power of two rates are extracted from the
+   * next finer level rather than from the full resolution image.
+   * @param rate
+   * @return
+   */
+  vtkImageData* getSubsampledImage(int rate);
+
+  /**
+   * @brief Copies the levels of the other settings' image pyramid when both display the
+   * same image so that each level is only extracted once
+   * @param other
+   */
+  void shareImagePyramid(const VSFilterViewSettings* other);
+
 private:
   VSAbstractFilter* m_Filter = nullptr;
   ActorType m_ActorType = ActorType::Invalid;
@@ -1011,6 +1167,11 @@ private:
   VTK_PTR(vtkProp3D) m_Actor = nullptr;
   VTK_PTR(vtkProp3D) m_OutlineActor = nullptr;
   VTK_PTR(vtkTexture) m_Texture = nullptr;
+  VSTextureCache::Key m_TextureKey;
+  VSTextureCache::Key m_ReplacedTextureKey;
+  VTK_PTR(vtkImageData) m_PyramidSource = nullptr;
+  vtkMTimeType m_PyramidMTime = 0;
+  std::map<int, VTK_PTR(vtkImageData)> m_ImagePyramid;
   VTK_PTR(vtkOutlineFilter) m_OutlineFilter = nullptr;
   VTK_PTR(vtkPlaneSource) m_Plane = nullptr;
   VSLookupTableController* m_LookupTable = nullptr;
@@ -1022,6 +1183,10 @@ private:
   VTK_PTR(vtkCubeAxesActor) m_CubeAxesActor = nullptr;
   bool m_GridVisible = false;
   bool m_Selected = false;
+  int m_BatchDepth = 0;
+  bool m_PendingColorMode = false;
+  bool m_PendingTexture = false;
+  bool m_PendingRender = false;
 
   QAction* m_SetColorAction = nullptr;
   QAction* m_SetOpacityAction = nullptr;
@@ -0,0 +1,648 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSMergedMontage.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include <QtConcurrent>
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkFloatArray.h>
+#include <vtkLookupTable.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyDataMapper.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.h"
+
+int VSMergedMontage::s_MaxAtlasSize = 4096;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSMergedMontage::GetMaxAtlasSize()
+{
+  return s_MaxAtlasSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::SetMaxAtlasSize(int size)
+{
+  s_MaxAtlasSize = std::max(size, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::update(const VSFilterViewSettings::Collection& tiles)
+{
+  std::vector<Tile> newTiles;
+  newTiles.reserve(tiles.size());
+  std::unordered_set<vtkActor*> newActors;
+  for(VSFilterViewSettings* settings : tiles)
+  {
+    vtkActor* actor = vtkActor::SafeDownCast(settings->getActor());
+    VTK_PTR(vtkTexture) texture = settings->getTexture();
+    if(nullptr == actor || nullptr == texture || nullptr == vtkImageData::SafeDownCast(texture->GetInput()))
+    {
+      continue;
+    }
+
+    Tile tile;
+    tile.Actor = actor;
+    tile.Texture = texture;
+    tile.ArrayName = settings->getActiveArrayName();
+    tile.PointData = settings->isPointData();
+    tile.Alpha = settings->getAlpha();
+    newTiles.push_back(tile);
+    newActors.insert(actor);
+  }
+
+  // Release the regions of tiles that are no longer displayed
+  for(auto iter = m_Tiles.begin(); iter != m_Tiles.end();)
+  {
+    if(newActors.find(iter->first) == newActors.end())
+    {
+      releaseSlot(iter->second);
+      m_MergedProps.erase(iter->first);
+      iter = m_Tiles.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  // The texture cache creates a new texture whenever the displayed colors change
+  std::vector<Tile*> changedTiles;
+  for(const Tile& newTile : newTiles)
+  {
+    auto iter = m_Tiles.find(newTile.Actor);
+    if(iter == m_Tiles.end())
+    {
+      iter = m_Tiles.insert(std::make_pair(newTile.Actor.Get(), newTile)).first;
+      changedTiles.push_back(&iter->second);
+      continue;
+    }
+
+    Tile& tile = iter->second;
+    if((tile.Texture != newTile.Texture) || (tile.ArrayName != newTile.ArrayName) || (tile.PointData != newTile.PointData) || (tile.Alpha != newTile.Alpha))
+    {
+      tile.Texture = newTile.Texture;
+      tile.ArrayName = newTile.ArrayName;
+      tile.PointData = newTile.PointData;
+      tile.Alpha = newTile.Alpha;
+      changedTiles.push_back(&tile);
+    }
+  }
+
+  if(!changedTiles.empty())
+  {
+    updateAtlases(changedTiles);
+  }
+
+  bool layoutChanged = false;
+  for(Atlas& atlas : m_Atlases)
+  {
+    if(atlas.LayoutChanged)
+    {
+      UpdateAtlasGeometry(atlas);
+      layoutChanged = true;
+    }
+  }
+  updateQuads(layoutChanged);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::clear()
+{
+  m_Tiles.clear();
+  m_Atlases.clear();
+  m_MergedProps.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VTK_PTR(vtkActor)> VSMergedMontage::getActors() const
+{
+  std::vector<VTK_PTR(vtkActor)> actors;
+  actors.reserve(m_Atlases.size());
+  for(const Atlas& atlas : m_Atlases)
+  {
+    // Atlases whose tiles were all removed are kept empty for reuse
+    if(nullptr != atlas.Actor)
+    {
+      actors.push_back(atlas.Actor);
+    }
+  }
+  return actors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMergedMontage::contains(vtkProp3D* prop) const
+{
+  return m_MergedProps.find(prop) != m_MergedProps.end();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::unordered_set<vtkProp3D*>& VSMergedMontage::getMergedProps() const
+{
+  return m_MergedProps;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSMergedMontage::getNumberOfTiles() const
+{
+  return m_MergedProps.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkUnsignedCharArray* VSMergedMontage::MapTileColors(const Tile& tile, int dims[2])
+{
+  vtkImageData* image = vtkImageData::SafeDownCast(tile.Texture->GetInput());
+  if(nullptr == image)
+  {
+    return nullptr;
+  }
+
+  vtkDataSetAttributes* attributes = tile.PointData ? static_cast<vtkDataSetAttributes*>(image->GetPointData()) : static_cast<vtkDataSetAttributes*>(image->GetCellData());
+  vtkDataArray* scalars = tile.ArrayName.isEmpty() ? attributes->GetScalars() : attributes->GetArray(qPrintable(tile.ArrayName));
+  if(nullptr == scalars)
+  {
+    return nullptr;
+  }
+
+  // Cell data is displayed with one texel per cell
+  int imageDims[3];
+  image->GetDimensions(imageDims);
+  bool cellTexels = !tile.PointData && (scalars->GetNumberOfTuples() != image->GetNumberOfPoints());
+  dims[0] = cellTexels ? std::max(imageDims[0] - 1, 1) : imageDims[0];
+  dims[1] = cellTexels ? std::max(imageDims[1] - 1, 1) : imageDims[1];
+  if(static_cast<vtkIdType>(dims[0]) * dims[1] != scalars->GetNumberOfTuples())
+  {
+    return nullptr;
+  }
+
+  bool mapScalars = (VTK_COLOR_MODE_MAP_SCALARS == tile.Texture->GetColorMode()) || (VTK_UNSIGNED_CHAR != scalars->GetDataType());
+  vtkScalarsToColors* lookupTable = tile.Texture->GetLookupTable();
+  VTK_PTR(vtkLookupTable) defaultTable = nullptr;
+  if(nullptr == lookupTable)
+  {
+    // Matches the default lookup table vtkTexture creates
+    double range[2] = {0.0, 1.0};
+    VSArrayStatistics::Instance()->getRange(scalars, -1, range);
+    defaultTable = VTK_PTR(vtkLookupTable)::New();
+    defaultTable->SetRange(range);
+    defaultTable->Build();
+    lookupTable = defaultTable;
+  }
+
+  return lookupTable->MapScalars(scalars, mapScalars ? VTK_COLOR_MODE_MAP_SCALARS : VTK_COLOR_MODE_DIRECT_SCALARS, -1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::updateAtlases(const std::vector<Tile*>& tiles)
+{
+  // Map each distinct texture once.  Textures own their lookup tables so they can be mapped in parallel.
+  struct MappedTexture
+  {
+    const Tile* Source = nullptr;
+    VTK_PTR(vtkUnsignedCharArray) Colors = nullptr;
+    int Dims[2] = {0, 0};
+  };
+  std::vector<MappedTexture> mappedTextures;
+  std::map<vtkTexture*, size_t> textureIndices;
+  std::vector<size_t> tileTextures(tiles.size());
+  for(size_t i = 0; i < tiles.size(); i++)
+  {
+    auto iter = textureIndices.find(tiles[i]->Texture);
+    if(iter == textureIndices.end())
+    {
+      iter = textureIndices.insert(std::make_pair(tiles[i]->Texture.Get(), mappedTextures.size())).first;
+      MappedTexture mappedTexture;
+      mappedTexture.Source = tiles[i];
+      mappedTextures.push_back(mappedTexture);
+    }
+    tileTextures[i] = iter->second;
+  }
+
+  QtConcurrent::blockingMap(mappedTextures, [](MappedTexture& mappedTexture) {
+    vtkUnsignedCharArray* colors = MapTileColors(*mappedTexture.Source, mappedTexture.Dims);
+    if(nullptr != colors)
+    {
+      mappedTexture.Colors.TakeReference(colors);
+    }
+  });
+
+  // Tiles keep their region while their texture still fits so that other tiles never move
+  std::vector<size_t> mergedTiles;
+  std::vector<size_t> unplacedTiles;
+  for(size_t i = 0; i < tiles.size(); i++)
+  {
+    Tile& tile = *tiles[i];
+    const MappedTexture& mappedTexture = mappedTextures[tileTextures[i]];
+    if(nullptr == mappedTexture.Colors || 4 != mappedTexture.Colors->GetNumberOfComponents() || mappedTexture.Dims[0] > s_MaxAtlasSize ||
+       mappedTexture.Dims[1] > s_MaxAtlasSize)
+    {
+      releaseSlot(tile);
+      m_MergedProps.erase(tile.Actor.Get());
+      continue;
+    }
+
+    mergedTiles.push_back(i);
+    if(tile.Atlas >= 0)
+    {
+      Slot& slot = m_Atlases[tile.Atlas].Slots[tile.Slot];
+      if(mappedTexture.Dims[0] <= slot.Capacity[0] && mappedTexture.Dims[1] <= slot.Capacity[1])
+      {
+        if(mappedTexture.Dims[0] != slot.Size[0] || mappedTexture.Dims[1] != slot.Size[1])
+        {
+          slot.Size[0] = mappedTexture.Dims[0];
+          slot.Size[1] = mappedTexture.Dims[1];
+          m_Atlases[tile.Atlas].LayoutChanged = true;
+        }
+        continue;
+      }
+      releaseSlot(tile);
+    }
+    unplacedTiles.push_back(i);
+  }
+
+  // Place new tiles ordered by height so that shelves waste little space
+  std::stable_sort(unplacedTiles.begin(), unplacedTiles.end(),
+                   [&](size_t lhs, size_t rhs) { return mappedTextures[tileTextures[lhs]].Dims[1] > mappedTextures[tileTextures[rhs]].Dims[1]; });
+  for(size_t index : unplacedTiles)
+  {
+    allocateSlot(*tiles[index], mappedTextures[tileTextures[index]].Dims);
+    m_MergedProps.insert(tiles[index]->Actor.Get());
+  }
+
+  for(Atlas& atlas : m_Atlases)
+  {
+    ResizeAtlasImage(atlas);
+  }
+
+  // Only the regions of the changed tiles are written
+  std::unordered_set<vtkImageData*> modifiedImages;
+  for(size_t index : mergedTiles)
+  {
+    const Tile& tile = *tiles[index];
+    Atlas& atlas = m_Atlases[tile.Atlas];
+    const Slot& slot = atlas.Slots[tile.Slot];
+    modifiedImages.insert(atlas.Image);
+
+    int atlasDims[3];
+    atlas.Image->GetDimensions(atlasDims);
+    unsigned char* pixels = static_cast<unsigned char*>(atlas.Image->GetScalarPointer());
+    const unsigned char* colors = mappedTextures[tileTextures[index]].Colors->GetPointer(0);
+    size_t rowBytes = 4 * static_cast<size_t>(slot.Size[0]);
+    for(int row = 0; row < slot.Size[1]; row++)
+    {
+      unsigned char* target = pixels + 4 * (static_cast<size_t>(slot.Offset[1] + row) * atlasDims[0] + slot.Offset[0]);
+      std::memcpy(target, colors + row * rowBytes, rowBytes);
+      if(tile.Alpha < 1.0)
+      {
+        for(size_t j = 3; j < rowBytes; j += 4)
+        {
+          target[j] = static_cast<unsigned char>(target[j] * tile.Alpha);
+        }
+      }
+    }
+  }
+
+  for(vtkImageData* image : modifiedImages)
+  {
+    image->Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::allocateSlot(Tile& tile, const int size[2])
+{
+  Slot slot;
+  slot.Actor = tile.Actor;
+  slot.Size[0] = size[0];
+  slot.Size[1] = size[1];
+
+  // Reuse the smallest released region that fits
+  int bestAtlas = -1;
+  int bestSlot = -1;
+  for(size_t i = 0; i < m_Atlases.size(); i++)
+  {
+    const std::vector<Slot>& slots = m_Atlases[i].Slots;
+    for(size_t j = 0; j < slots.size(); j++)
+    {
+      const Slot& candidate = slots[j];
+      if(nullptr != candidate.Actor || candidate.Capacity[0] < size[0] || candidate.Capacity[1] < size[1])
+      {
+        continue;
+      }
+      if(bestAtlas < 0 || candidate.Capacity[0] * candidate.Capacity[1] < m_Atlases[bestAtlas].Slots[bestSlot].Capacity[0] * m_Atlases[bestAtlas].Slots[bestSlot].Capacity[1])
+      {
+        bestAtlas = static_cast<int>(i);
+        bestSlot = static_cast<int>(j);
+      }
+    }
+  }
+  if(bestAtlas >= 0)
+  {
+    Slot& released = m_Atlases[bestAtlas].Slots[bestSlot];
+    slot.Offset[0] = released.Offset[0];
+    slot.Offset[1] = released.Offset[1];
+    slot.Capacity[0] = released.Capacity[0];
+    slot.Capacity[1] = released.Capacity[1];
+    released = slot;
+    m_Atlases[bestAtlas].LayoutChanged = true;
+    tile.Atlas = bestAtlas;
+    tile.Slot = bestSlot;
+    return;
+  }
+
+  // Otherwise append to the shelves of the first atlas with room
+  for(size_t i = 0; i <= m_Atlases.size(); i++)
+  {
+    if(i == m_Atlases.size())
+    {
+      m_Atlases.push_back(Atlas());
+    }
+
+    Atlas& atlas = m_Atlases[i];
+    int x = atlas.Cursor[0];
+    int y = atlas.Cursor[1];
+    int rowHeight = atlas.RowHeight;
+    if(x + size[0] > s_MaxAtlasSize)
+    {
+      x = 0;
+      y += rowHeight;
+      rowHeight = 0;
+    }
+    if(y + size[1] > s_MaxAtlasSize)
+    {
+      continue;
+    }
+
+    slot.Offset[0] = x;
+    slot.Offset[1] = y;
+    slot.Capacity[0] = size[0];
+    slot.Capacity[1] = size[1];
+    atlas.Cursor[0] = x + size[0];
+    atlas.Cursor[1] = y;
+    atlas.RowHeight = std::max(rowHeight, size[1]);
+    atlas.Extent[0] = std::max(atlas.Extent[0], x + size[0]);
+    atlas.Extent[1] = std::max(atlas.Extent[1], y + size[1]);
+    atlas.Slots.push_back(slot);
+    atlas.LayoutChanged = true;
+    tile.Atlas = static_cast<int>(i);
+    tile.Slot = static_cast<int>(atlas.Slots.size()) - 1;
+    return;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::releaseSlot(Tile& tile)
+{
+  if(tile.Atlas < 0)
+  {
+    return;
+  }
+
+  Atlas& atlas = m_Atlases[tile.Atlas];
+  atlas.Slots[tile.Slot].Actor = nullptr;
+  atlas.LayoutChanged = true;
+  tile.Atlas = -1;
+  tile.Slot = -1;
+
+  // An atlas without tiles starts over so that it does not keep its old image
+  bool empty = std::none_of(atlas.Slots.begin(), atlas.Slots.end(), [](const Slot& slot) { return nullptr != slot.Actor; });
+  if(empty)
+  {
+    atlas.Slots.clear();
+    atlas.Image = nullptr;
+    atlas.Extent[0] = atlas.Extent[1] = 0;
+    atlas.Cursor[0] = atlas.Cursor[1] = 0;
+    atlas.RowHeight = 0;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::ResizeAtlasImage(Atlas& atlas)
+{
+  int dims[3] = {0, 0, 1};
+  if(nullptr != atlas.Image)
+  {
+    atlas.Image->GetDimensions(dims);
+  }
+  if(atlas.Extent[0] <= dims[0] && atlas.Extent[1] <= dims[1])
+  {
+    return;
+  }
+
+  // Grow geometrically so that tiles added one at a time do not copy the atlas every time
+  int newDims[2];
+  for(int i = 0; i < 2; i++)
+  {
+    newDims[i] = (atlas.Extent[i] <= dims[i]) ? dims[i] : std::min(std::max(atlas.Extent[i], 2 * dims[i]), s_MaxAtlasSize);
+  }
+
+  VTK_NEW(vtkImageData, image);
+  image->SetDimensions(newDims[0], newDims[1], 1);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 4);
+  unsigned char* pixels = static_cast<unsigned char*>(image->GetScalarPointer());
+  std::memset(pixels, 0, 4 * static_cast<size_t>(newDims[0]) * newDims[1]);
+  if(nullptr != atlas.Image)
+  {
+    const unsigned char* oldPixels = static_cast<const unsigned char*>(atlas.Image->GetScalarPointer());
+    size_t rowBytes = 4 * static_cast<size_t>(dims[0]);
+    for(int row = 0; row < dims[1]; row++)
+    {
+      std::memcpy(pixels + 4 * static_cast<size_t>(row) * newDims[0], oldPixels + row * rowBytes, rowBytes);
+    }
+  }
+
+  atlas.Image = image;
+  atlas.LayoutChanged = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::UpdateAtlasGeometry(Atlas& atlas)
+{
+  atlas.LayoutChanged = false;
+  if(nullptr == atlas.Image)
+  {
+    atlas.Quads = nullptr;
+    atlas.Actor = nullptr;
+    return;
+  }
+
+  int atlasDims[3];
+  atlas.Image->GetDimensions(atlasDims);
+  vtkIdType numTiles = static_cast<vtkIdType>(std::count_if(atlas.Slots.begin(), atlas.Slots.end(), [](const Slot& slot) { return nullptr != slot.Actor; }));
+
+  VTK_NEW(vtkPoints, points);
+  points->SetNumberOfPoints(4 * numTiles);
+  VTK_NEW(vtkFloatArray, textureCoords);
+  textureCoords->SetNumberOfComponents(2);
+  textureCoords->SetNumberOfTuples(4 * numTiles);
+  VTK_NEW(vtkCellArray, quads);
+  quads->Allocate(quads->EstimateSize(numTiles, 4));
+
+  vtkIdType quadId = 0;
+  for(Slot& slot : atlas.Slots)
+  {
+    if(nullptr == slot.Actor)
+    {
+      slot.Quad = -1;
+      continue;
+    }
+
+    // Sample texel centers so interpolation does not bleed into neighboring tiles
+    float u0 = (slot.Offset[0] + 0.5f) / atlasDims[0];
+    float u1 = (slot.Offset[0] + slot.Size[0] - 0.5f) / atlasDims[0];
+    float v0 = (slot.Offset[1] + 0.5f) / atlasDims[1];
+    float v1 = (slot.Offset[1] + slot.Size[1] - 0.5f) / atlasDims[1];
+    vtkIdType first = 4 * quadId;
+    textureCoords->SetTuple2(first, u0, v0);
+    textureCoords->SetTuple2(first + 1, u1, v0);
+    textureCoords->SetTuple2(first + 2, u1, v1);
+    textureCoords->SetTuple2(first + 3, u0, v1);
+
+    vtkIdType quad[4] = {first, first + 1, first + 2, first + 3};
+    quads->InsertNextCell(4, quad);
+    slot.Quad = quadId++;
+  }
+
+  if(nullptr == atlas.Quads)
+  {
+    atlas.Quads = VTK_PTR(vtkPolyData)::New();
+  }
+  atlas.Quads->SetPoints(points);
+  atlas.Quads->SetPolys(quads);
+  atlas.Quads->GetPointData()->SetTCoords(textureCoords);
+
+  if(nullptr == atlas.Actor)
+  {
+    VTK_NEW(vtkTexture, texture);
+    texture->InterpolateOn();
+    texture->SetColorModeToDirectScalars();
+
+    VTK_NEW(vtkPolyDataMapper, mapper);
+    mapper->SetInputData(atlas.Quads);
+    mapper->ScalarVisibilityOff();
+
+    atlas.Actor = VTK_PTR(vtkActor)::New();
+    atlas.Actor->SetMapper(mapper);
+    atlas.Actor->SetTexture(texture);
+    // Tiles are picked through their own actors
+    atlas.Actor->PickableOff();
+  }
+  atlas.Actor->GetTexture()->SetInputData(atlas.Image);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMergedMontage::updateQuads(bool force)
+{
+  bool modified = force;
+  for(auto iter = m_Tiles.begin(); !modified && iter != m_Tiles.end(); ++iter)
+  {
+    const Tile& tile = iter->second;
+    modified = (tile.Atlas >= 0) && (tile.Actor->GetMTime() > m_QuadTime.GetMTime());
+  }
+  if(!modified)
+  {
+    return;
+  }
+
+  // Corners of the vtkPlaneSource used by the tile actors
+  const double corners[4][4] = {{-0.5, -0.5, 0.0, 1.0}, {0.5, -0.5, 0.0, 1.0}, {0.5, 0.5, 0.0, 1.0}, {-0.5, 0.5, 0.0, 1.0}};
+  for(Atlas& atlas : m_Atlases)
+  {
+    if(nullptr == atlas.Quads)
+    {
+      continue;
+    }
+
+    vtkPoints* points = atlas.Quads->GetPoints();
+    for(const Slot& slot : atlas.Slots)
+    {
+      if(slot.Quad < 0)
+      {
+        continue;
+      }
+
+      vtkMatrix4x4* matrix = slot.Actor->GetMatrix();
+      for(int corner = 0; corner < 4; corner++)
+      {
+        double point[4];
+        matrix->MultiplyPoint(corners[corner], point);
+        double w = (0.0 != point[3]) ? point[3] : 1.0;
+        points->SetPoint(4 * slot.Quad + corner, point[0] / w, point[1] / w, point[2] / w);
+      }
+    }
+    points->Modified();
+  }
+
+  m_QuadTime.Modified();
+}
@@ -0,0 +1,213 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <vtkActor.h>
+#include <vtkImageData.h>
+#include <vtkPolyData.h>
+#include <vtkTexture.h>
+#include <vtkTimeStamp.h>
+#include <vtkUnsignedCharArray.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewSettings.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSMergedMontage VSMergedMontage.h
+ * SIMPLVtkLib/Visualization/Controllers/VSMergedMontage.h
+ * @brief This class draws the flat image tiles of a montage through a small number
+ * of actors instead of one actor per tile.  Tile textures are mapped to colors and
+ * packed into texture atlases, and every atlas is drawn as a single vtkPolyData
+ * holding one quad per tile.  Each quad is placed with its tile actor's matrix so
+ * that tile transforms are carried per tile without additional actors.  Only plain
+ * polygons and 2D textures are used so the merged montage also renders under
+ * software OpenGL.
+ */
+class SIMPLVtkLib_EXPORT VSMergedMontage
+{
+public:
+  VSMergedMontage() = default;
+
+  /**
+   * @brief Merges the given Image2D view settings.  Only tiles that are new or whose
+   * texture or alpha changed are mapped to colors and copied into their atlas region.
+   * Merged tiles keep their region for as long as their texture fits in it, and the
+   * regions of removed tiles are reused before new space is taken.  Otherwise only
+   * the quads are moved to match the tile actors.  Tiles whose texture does not fit
+   * in an atlas are not merged.
+   * @param tiles
+   */
+  void update(const VSFilterViewSettings::Collection& tiles);
+
+  /**
+   * @brief Removes all tiles and atlases
+   */
+  void clear();
+
+  /**
+   * @brief Returns the actors drawing the atlases
+   * @return
+   */
+  std::vector<VTK_PTR(vtkActor)> getActors() const;
+
+  /**
+   * @brief Returns true if the given tile actor is drawn through an atlas.  Returns false otherwise.
+   * @param prop
+   * @return
+   */
+  bool contains(vtkProp3D* prop) const;
+
+  /**
+   * @brief Returns the tile actors drawn through the atlases
+   * @return
+   */
+  const std::unordered_set<vtkProp3D*>& getMergedProps() const;
+
+  /**
+   * @brief Returns the number of merged tiles
+   * @return
+   */
+  size_t getNumberOfTiles() const;
+
+  /**
+   * @brief Returns the maximum width and height of an atlas in pixels
+   * @return
+   */
+  static int GetMaxAtlasSize();
+
+  /**
+   * @brief Sets the maximum width and height of an atlas in pixels.  This should not
+   * exceed the OpenGL maximum texture size.
+   * @param size
+   */
+  static void SetMaxAtlasSize(int size);
+
+protected:
+  struct Tile
+  {
+    VTK_PTR(vtkActor) Actor = nullptr;
+    VTK_PTR(vtkTexture) Texture = nullptr;
+    QString ArrayName;
+    bool PointData = true;
+    double Alpha = 1.0;
+    int Atlas = -1;
+    int Slot = -1;
+  };
+
+  struct Slot
+  {
+    vtkActor* Actor = nullptr;
+    int Offset[2] = {0, 0};
+    int Capacity[2] = {0, 0};
+    int Size[2] = {0, 0};
+    vtkIdType Quad = -1;
+  };
+
+  struct Atlas
+  {
+    VTK_PTR(vtkImageData) Image = nullptr;
+    VTK_PTR(vtkPolyData) Quads = nullptr;
+    VTK_PTR(vtkActor) Actor = nullptr;
+    std::vector<Slot> Slots;
+    int Extent[2] = {0, 0};
+    int Cursor[2] = {0, 0};
+    int RowHeight = 0;
+    bool LayoutChanged = false;
+  };
+
+  /**
+   * @brief Maps the given tiles to colors and copies them into their atlas regions.
+   * Tiles that no longer fit in their region are placed without moving other tiles.
+   * @param tiles
+   */
+  void updateAtlases(const std::vector<Tile*>& tiles);
+
+  /**
+   * @brief Places the tile in a released region that fits its size or in new space
+   * at the end of an atlas, creating a new atlas when none of them have room.
+   * @param tile
+   * @param size
+   */
+  void allocateSlot(Tile& tile, const int size[2]);
+
+  /**
+   * @brief Releases the tile's atlas region so that it can be reused by another tile
+   * @param tile
+   */
+  void releaseSlot(Tile& tile);
+
+  /**
+   * @brief Grows the atlas image to cover its allocated regions, keeping the existing pixels
+   * @param atlas
+   */
+  static void ResizeAtlasImage(Atlas& atlas);
+
+  /**
+   * @brief Recreates the atlas quads and texture coordinates after its regions changed
+   * @param atlas
+   */
+  static void UpdateAtlasGeometry(Atlas& atlas);
+
+  /**
+   * @brief Moves the atlas quads to match the tile actors if any of them changed
+   * @param force
+   */
+  void updateQuads(bool force);
+
+  /**
+   * @brief Returns the tile texture mapped to RGBA colors.  The caller takes
+   * ownership of the returned array.
+   * @param tile
+   * @param dims
+   * @return
+   */
+  static vtkUnsignedCharArray* MapTileColors(const Tile& tile, int dims[2]);
+
+private:
+  std::unordered_map<vtkActor*, Tile> m_Tiles;
+  std::vector<Atlas> m_Atlases;
+  std::unordered_set<vtkProp3D*> m_MergedProps;
+  vtkTimeStamp m_QuadTime;
+
+  static int s_MaxAtlasSize;
+};
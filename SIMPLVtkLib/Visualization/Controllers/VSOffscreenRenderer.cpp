@@ -0,0 +1,244 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSOffscreenRenderer.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QElapsedTimer>
+
+#include <vtkPNGWriter.h>
+#include <vtkPointData.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkWindowToImageFilter.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOffscreenRenderer::VSOffscreenRenderer(QObject* parent)
+: QObject(parent)
+, m_FilterViewModel(new VSFilterViewModel(this))
+{
+  m_Renderer = VTK_PTR(vtkRenderer)::New();
+  m_Renderer->SetBackground(0.3, 0.3, 0.35);
+
+  m_RenderWindow = VTK_PTR(vtkRenderWindow)::New();
+  m_RenderWindow->SetOffScreenRendering(1);
+  m_RenderWindow->AddRenderer(m_Renderer);
+  m_RenderWindow->SetSize(800, 600);
+
+  connect(m_FilterViewModel, &VSFilterViewModel::viewSettingsCreated, this, &VSOffscreenRenderer::addViewSettings);
+  connect(m_FilterViewModel, &VSFilterViewModel::viewSettingsRemoved, this, &VSOffscreenRenderer::removeViewSettings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSController* VSOffscreenRenderer::getController() const
+{
+  return m_Controller;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOffscreenRenderer::setController(VSController* controller)
+{
+  m_Controller = controller;
+  m_Renderer->RemoveAllViewProps();
+  // VSFilterViewModel emits viewSettingsCreated for each existing filter
+  m_FilterViewModel->setFilterModel(controller ? controller->getFilterModel() : nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewModel* VSOffscreenRenderer::getFilterViewModel() const
+{
+  return m_FilterViewModel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkRenderer* VSOffscreenRenderer::getRenderer() const
+{
+  return m_Renderer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkRenderWindow* VSOffscreenRenderer::getRenderWindow() const
+{
+  return m_RenderWindow;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOffscreenRenderer::setSize(int width, int height)
+{
+  m_RenderWindow->SetSize(width, height);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOffscreenRenderer::resetCamera()
+{
+  m_Renderer->ResetCamera();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSOffscreenRenderer::render()
+{
+  QElapsedTimer timer;
+  timer.start();
+
+  m_RenderWindow->Render();
+  // Rendering may be asynchronous so wait for the frame before stopping the timer
+  m_RenderWindow->WaitForCompletion();
+
+  return timer.nsecsElapsed() / 1.0e6;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSOffscreenRenderer::captureImage()
+{
+  VTK_NEW(vtkWindowToImageFilter, windowToImage);
+  windowToImage->SetInput(m_RenderWindow);
+  windowToImage->SetInputBufferTypeToRGBA();
+  windowToImage->ReadFrontBufferOff();
+  windowToImage->Update();
+
+  VTK_PTR(vtkImageData) image = VTK_PTR(vtkImageData)::New();
+  image->DeepCopy(windowToImage->GetOutput());
+  return image;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray VSOffscreenRenderer::getImageChecksum()
+{
+  VTK_PTR(vtkImageData) image = captureImage();
+  vtkUnsignedCharArray* pixels = vtkUnsignedCharArray::SafeDownCast(image->GetPointData()->GetScalars());
+  if(nullptr == pixels)
+  {
+    return QByteArray();
+  }
+
+  int dims[3];
+  image->GetDimensions(dims);
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  hash.addData(reinterpret_cast<const char*>(dims), sizeof(dims));
+  hash.addData(reinterpret_cast<const char*>(pixels->GetPointer(0)), static_cast<int>(pixels->GetDataSize() * pixels->GetDataTypeSize()));
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOffscreenRenderer::saveImage(const QString& filePath)
+{
+  VTK_NEW(vtkWindowToImageFilter, windowToImage);
+  windowToImage->SetInput(m_RenderWindow);
+  windowToImage->SetInputBufferTypeToRGBA();
+  windowToImage->ReadFrontBufferOff();
+  windowToImage->Update();
+
+  VTK_NEW(vtkPNGWriter, imageWriter);
+  imageWriter->SetFileName(filePath.toStdString().c_str());
+  imageWriter->SetInputConnection(windowToImage->GetOutputPort());
+  imageWriter->Write();
+  return 0 == imageWriter->GetErrorCode();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOffscreenRenderer::addViewSettings(VSFilterViewSettings* viewSettings)
+{
+  if(nullptr == viewSettings)
+  {
+    return;
+  }
+
+  connect(viewSettings, &VSFilterViewSettings::visibilityChanged, this, [this, viewSettings](bool) { updateActor(viewSettings); });
+  connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, [this, viewSettings]() { updateActor(viewSettings); });
+  connect(viewSettings, &VSFilterViewSettings::swappingActors, this, [this](vtkProp3D* oldProp, vtkProp3D* newProp) {
+    m_Renderer->RemoveViewProp(oldProp);
+    m_Renderer->AddViewProp(newProp);
+  });
+
+  updateActor(viewSettings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOffscreenRenderer::removeViewSettings(VSFilterViewSettings* viewSettings)
+{
+  if(viewSettings && viewSettings->getActor())
+  {
+    m_Renderer->RemoveViewProp(viewSettings->getActor());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOffscreenRenderer::updateActor(VSFilterViewSettings* viewSettings)
+{
+  vtkProp3D* actor = viewSettings->getActor();
+  if(nullptr == actor)
+  {
+    return;
+  }
+
+  if(viewSettings->isValid() && viewSettings->isVisible())
+  {
+    m_Renderer->AddViewProp(actor);
+  }
+  else
+  {
+    m_Renderer->RemoveViewProp(actor);
+  }
+}
@@ -0,0 +1,168 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include <vtkImageData.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSOffscreenRenderer VSOffscreenRenderer.h SIMPLVtkLib/Visualization/Controllers/VSOffscreenRenderer.h
+ * @brief This class renders a VSController's filters without a display.  It uses the
+ * same VSFilterViewModel and VSFilterViewSettings actor setup as VSAbstractViewWidget
+ * but draws into an offscreen vtkRenderWindow instead of a QVTKOpenGLWidget.  When VTK
+ * is built with OSMesa, the window renders in software with no GPU or X server.
+ */
+class SIMPLVtkLib_EXPORT VSOffscreenRenderer : public QObject
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSOffscreenRenderer(QObject* parent = nullptr);
+
+  /**
+   * @brief Deconstructor
+   */
+  ~VSOffscreenRenderer() override = default;
+
+  /**
+   * @brief Returns the VSController whose filters are rendered
+   * @return
+   */
+  VSController* getController() const;
+
+  /**
+   * @brief Sets the VSController whose filters are rendered
+   * @param controller
+   */
+  void setController(VSController* controller);
+
+  /**
+   * @brief Returns the VSFilterViewModel used
+   * @return
+   */
+  VSFilterViewModel* getFilterViewModel() const;
+
+  /**
+   * @brief Returns the vtkRenderer used
+   * @return
+   */
+  vtkRenderer* getRenderer() const;
+
+  /**
+   * @brief Returns the offscreen vtkRenderWindow
+   * @return
+   */
+  vtkRenderWindow* getRenderWindow() const;
+
+  /**
+   * @brief Sets the size of the rendered image in pixels
+   * @param width
+   * @param height
+   */
+  void setSize(int width, int height);
+
+  /**
+   * @brief Resets the camera to show all visible filters
+   */
+  void resetCamera();
+
+  /**
+   * @brief Renders a frame and waits for it to complete.  Returns the time taken in milliseconds.
+   * @return
+   */
+  double render();
+
+  /**
+   * @brief Returns a copy of the last rendered frame as an RGBA image
+   * @return
+   */
+  VTK_PTR(vtkImageData) captureImage();
+
+  /**
+   * @brief Returns the hex encoded MD5 checksum of the last rendered frame's pixels
+   * @return
+   */
+  QByteArray getImageChecksum();
+
+  /**
+   * @brief Saves the last rendered frame as a PNG image.  Returns false if the
+   * image could not be written.
+   * @param filePath
+   * @return
+   */
+  bool saveImage(const QString& filePath);
+
+protected:
+  /**
+   * @brief Makes the connections for a new VSFilterViewSettings and adds its actor if visible
+   * @param viewSettings
+   */
+  void addViewSettings(VSFilterViewSettings* viewSettings);
+
+  /**
+   * @brief Removes the actor for a VSFilterViewSettings being removed
+   * @param viewSettings
+   */
+  void removeViewSettings(VSFilterViewSettings* viewSettings);
+
+  /**
+   * @brief Adds or removes the VSFilterViewSettings actor based on its validity and visibility
+   * @param viewSettings
+   */
+  void updateActor(VSFilterViewSettings* viewSettings);
+
+private:
+  VSController* m_Controller = nullptr;
+  VSFilterViewModel* m_FilterViewModel = nullptr;
+  VTK_PTR(vtkRenderer) m_Renderer = nullptr;
+  VTK_PTR(vtkRenderWindow) m_RenderWindow = nullptr;
+};
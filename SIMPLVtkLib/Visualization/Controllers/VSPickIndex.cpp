@@ -0,0 +1,318 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSPickIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// Maximum number of actors stored in a leaf node
+const int s_MaxLeafSize = 4;
+
+/**
+ * @brief Returns the parametric distance along the segment p0 + t * dir where it
+ * enters the bounds or a negative value if the segment misses the bounds
+ * @param bounds
+ * @param p0
+ * @param dir
+ * @return
+ */
+double intersectBounds(const double bounds[6], const double p0[3], const double dir[3])
+{
+  double tMin = 0.0;
+  double tMax = 1.0;
+  for(int i = 0; i < 3; i++)
+  {
+    double min = bounds[2 * i];
+    double max = bounds[2 * i + 1];
+    if(std::abs(dir[i]) < std::numeric_limits<double>::epsilon())
+    {
+      // Segment is parallel to the slab
+      if(p0[i] < min || p0[i] > max)
+      {
+        return -1.0;
+      }
+      continue;
+    }
+
+    double t0 = (min - p0[i]) / dir[i];
+    double t1 = (max - p0[i]) / dir[i];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return -1.0;
+    }
+  }
+
+  return tMin;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSPickIndex::rebuild(const VSFilterViewSettings::Map& viewSettings)
+{
+  m_Entries.clear();
+  m_EntryBounds.clear();
+  m_Nodes.clear();
+  m_PropFilters.clear();
+
+  for(const auto& settingPair : viewSettings)
+  {
+    VSFilterViewSettings* settings = settingPair.second;
+    if(nullptr == settings || !settings->isValid())
+    {
+      continue;
+    }
+
+    vtkProp3D* prop = settings->getActor();
+    if(nullptr == prop)
+    {
+      continue;
+    }
+    m_PropFilters[prop] = settingPair.first;
+
+    // Hidden filters are removed from the renderer rather than having their visibility turned off
+    if(!settings->isVisible() || !prop->GetVisibility() || !prop->GetPickable())
+    {
+      continue;
+    }
+
+    double* bounds = prop->GetBounds();
+    if(nullptr == bounds || bounds[0] > bounds[1])
+    {
+      continue;
+    }
+
+    Bounds entryBounds;
+    std::copy(bounds, bounds + 6, entryBounds.begin());
+    m_Entries.push_back(std::make_pair(prop, settingPair.first));
+    m_EntryBounds.push_back(entryBounds);
+  }
+
+  if(!m_Entries.empty())
+  {
+    m_Nodes.reserve(2 * m_Entries.size() / s_MaxLeafSize + 1);
+    buildNode(0, static_cast<int>(m_Entries.size()));
+  }
+
+  m_BuildTime.Modified();
+  m_Valid = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSPickIndex::buildNode(int first, int count)
+{
+  Node node;
+  node.m_Bounds = {std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max(),
+                   std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+  for(int i = first; i < first + count; i++)
+  {
+    const Bounds& bounds = m_EntryBounds[i];
+    for(int j = 0; j < 3; j++)
+    {
+      node.m_Bounds[2 * j] = std::min(node.m_Bounds[2 * j], bounds[2 * j]);
+      node.m_Bounds[2 * j + 1] = std::max(node.m_Bounds[2 * j + 1], bounds[2 * j + 1]);
+    }
+  }
+
+  int nodeIndex = static_cast<int>(m_Nodes.size());
+  m_Nodes.push_back(node);
+  if(count <= s_MaxLeafSize)
+  {
+    m_Nodes[nodeIndex].m_First = first;
+    m_Nodes[nodeIndex].m_Count = count;
+    return nodeIndex;
+  }
+
+  // Split at the median centroid along the longest axis
+  int axis = 0;
+  double maxLength = -1.0;
+  for(int j = 0; j < 3; j++)
+  {
+    double length = node.m_Bounds[2 * j + 1] - node.m_Bounds[2 * j];
+    if(length > maxLength)
+    {
+      maxLength = length;
+      axis = j;
+    }
+  }
+
+  std::vector<int> order(count);
+  for(int i = 0; i < count; i++)
+  {
+    order[i] = first + i;
+  }
+  int half = count / 2;
+  std::nth_element(order.begin(), order.begin() + half, order.end(), [this, axis](int lhs, int rhs) {
+    const Bounds& lhsBounds = m_EntryBounds[lhs];
+    const Bounds& rhsBounds = m_EntryBounds[rhs];
+    return (lhsBounds[2 * axis] + lhsBounds[2 * axis + 1]) < (rhsBounds[2 * axis] + rhsBounds[2 * axis + 1]);
+  });
+
+  std::vector<FilterProp> entries(count);
+  std::vector<Bounds> entryBounds(count);
+  for(int i = 0; i < count; i++)
+  {
+    entries[i] = m_Entries[order[i]];
+    entryBounds[i] = m_EntryBounds[order[i]];
+  }
+  std::copy(entries.begin(), entries.end(), m_Entries.begin() + first);
+  std::copy(entryBounds.begin(), entryBounds.end(), m_EntryBounds.begin() + first);
+
+  int left = buildNode(first, half);
+  int right = buildNode(first + half, count - half);
+  m_Nodes[nodeIndex].m_Left = left;
+  m_Nodes[nodeIndex].m_Right = right;
+  return nodeIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSPickIndex::invalidate()
+{
+  m_Valid = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSPickIndex::isValid() const
+{
+  if(!m_Valid)
+  {
+    return false;
+  }
+
+  // Moving, hiding, or transforming an actor modifies it.  The redraw time also
+  // includes the mapper and its input so that new filter outputs are noticed.
+  for(const auto& propFilter : m_PropFilters)
+  {
+    if(propFilter.first->GetRedrawMTime() > m_BuildTime.GetMTime())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSPickIndex::getFilter(vtkProp3D* prop) const
+{
+  auto iter = m_PropFilters.find(prop);
+  if(iter == m_PropFilters.end())
+  {
+    return nullptr;
+  }
+
+  return iter->second;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VSPickIndex::FilterProp> VSPickIndex::findCandidates(const double p0[3], const double p1[3]) const
+{
+  std::vector<std::pair<double, int>> hits;
+  if(m_Nodes.empty())
+  {
+    return std::vector<FilterProp>();
+  }
+
+  double dir[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+
+  std::vector<int> stack;
+  stack.push_back(0);
+  while(!stack.empty())
+  {
+    const Node& node = m_Nodes[stack.back()];
+    stack.pop_back();
+    if(intersectBounds(node.m_Bounds.data(), p0, dir) < 0.0)
+    {
+      continue;
+    }
+
+    if(node.m_Left < 0)
+    {
+      for(int i = node.m_First; i < node.m_First + node.m_Count; i++)
+      {
+        double t = intersectBounds(m_EntryBounds[i].data(), p0, dir);
+        if(t >= 0.0)
+        {
+          hits.push_back(std::make_pair(t, i));
+        }
+      }
+    }
+    else
+    {
+      stack.push_back(node.m_Left);
+      stack.push_back(node.m_Right);
+    }
+  }
+
+  std::sort(hits.begin(), hits.end());
+
+  std::vector<FilterProp> candidates;
+  candidates.reserve(hits.size());
+  for(const auto& hit : hits)
+  {
+    candidates.push_back(m_Entries[hit.second]);
+  }
+  return candidates;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSPickIndex::size() const
+{
+  return m_Entries.size();
+}
@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vtkProp3D.h>
+#include <vtkTimeStamp.h>
+
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewSettings.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSPickIndex VSPickIndex.h SIMPLVtkLib/Visualization/Controllers/VSPickIndex.h
+ * @brief This class stores a bounding volume hierarchy over the world bounds of
+ * the actors displayed in a view so that picking only needs to test the few
+ * actors whose bounds are crossed by the pick ray.  Nodes are split along their
+ * longest axis, which keeps flat montages partitioned in the image plane.  The
+ * index also maps each actor back to its filter in constant time.
+ */
+class SIMPLVtkLib_EXPORT VSPickIndex
+{
+public:
+  using FilterProp = std::pair<vtkProp3D*, VSAbstractFilter*>;
+
+  VSPickIndex() = default;
+
+  /**
+   * @brief Rebuilds the index from the given view settings.  Only visible and
+   * pickable actors are added to the hierarchy but every actor can be used to
+   * look up its filter.
+   * @param viewSettings
+   */
+  void rebuild(const VSFilterViewSettings::Map& viewSettings);
+
+  /**
+   * @brief Marks the index as out of date
+   */
+  void invalidate();
+
+  /**
+   * @brief Returns true if the index has been built since it was last invalidated
+   * and none of the indexed actors, their mappers, or the mapper inputs have been
+   * modified since then
+   * @return
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the filter displayed by the given actor or nullptr if the
+   * actor does not belong to any filter
+   * @param prop
+   * @return
+   */
+  VSAbstractFilter* getFilter(vtkProp3D* prop) const;
+
+  /**
+   * @brief Returns the actors whose world bounds are crossed by the segment
+   * between the given points ordered by their distance from the first point
+   * @param p0
+   * @param p1
+   * @return
+   */
+  std::vector<FilterProp> findCandidates(const double p0[3], const double p1[3]) const;
+
+  /**
+   * @brief Returns the number of actors in the hierarchy
+   * @return
+   */
+  size_t size() const;
+
+protected:
+  /**
+   * @brief Creates the node for the entries in the range [first, first + count)
+   * and returns its index
+   * @param first
+   * @param count
+   * @return
+   */
+  int buildNode(int first, int count);
+
+private:
+  using Bounds = std::array<double, 6>;
+
+  struct Node
+  {
+    Bounds m_Bounds;
+    int m_Left = -1;
+    int m_Right = -1;
+    int m_First = 0;
+    int m_Count = 0;
+  };
+
+  std::vector<FilterProp> m_Entries;
+  std::vector<Bounds> m_EntryBounds;
+  std::vector<Node> m_Nodes;
+  std::unordered_map<vtkProp3D*, VSAbstractFilter*> m_PropFilters;
+  vtkTimeStamp m_BuildTime;
+  bool m_Valid = false;
+};
@@ -0,0 +1,239 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSTextureCache.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include <QtCore/QMutexLocker>
+
+#include <vtkColorTransferFunction.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextureCache::Key::operator<(const Key& other) const
+{
+  return std::tie(DataSet, DataSetTime, ArrayName, Component, Subsampling, MapScalars, LookupTable) <
+         std::tie(other.DataSet, other.DataSetTime, other.ArrayName, other.Component, other.Subsampling, other.MapScalars, other.LookupTable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextureCache::Key::operator==(const Key& other) const
+{
+  return std::tie(DataSet, DataSetTime, ArrayName, Component, Subsampling, MapScalars, LookupTable) ==
+         std::tie(other.DataSet, other.DataSetTime, other.ArrayName, other.Component, other.Subsampling, other.MapScalars, other.LookupTable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTextureCache::Key::operator!=(const Key& other) const
+{
+  return !(*this == other);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTextureCache* VSTextureCache::Instance()
+{
+  static VSTextureCache* instance = new VSTextureCache();
+  return instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTextureCache::Key VSTextureCache::CreateKey(vtkImageData* dataSet, const QString& arrayName, int component, int subsampling, bool mapScalars, vtkColorTransferFunction* lookupTable)
+{
+  Key key;
+  key.DataSet = dataSet;
+  key.DataSetTime = (nullptr != dataSet) ? dataSet->GetMTime() : 0;
+  key.ArrayName = arrayName;
+  key.Component = component;
+  key.Subsampling = subsampling;
+  key.MapScalars = mapScalars;
+
+  // Views copy lookup tables by value, so compare the contents instead of the MTime
+  if(nullptr != lookupTable)
+  {
+    int size = lookupTable->GetSize();
+    key.LookupTable.reserve(6 * size + 1);
+    key.LookupTable.push_back(lookupTable->GetColorSpace());
+
+    double node[6];
+    for(int i = 0; i < size; i++)
+    {
+      lookupTable->GetNodeValue(i, node);
+      key.LookupTable.insert(key.LookupTable.end(), node, node + 6);
+    }
+  }
+
+  return key;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkTexture) VSTextureCache::getTexture(const Key& key, vtkImageData* image, vtkColorTransferFunction* lookupTable)
+{
+  if(nullptr == image)
+  {
+    return nullptr;
+  }
+
+  QMutexLocker locker(&m_Lock);
+  auto iter = m_Textures.find(key);
+  if(iter != m_Textures.end())
+  {
+    return iter->second;
+  }
+
+  if(m_Textures.size() >= m_PruneSize)
+  {
+    pruneUnusedTextures();
+  }
+
+  VTK_NEW(vtkTexture, texture);
+  texture->InterpolateOn();
+  texture->SetInputData(image);
+  if(!key.ArrayName.isEmpty())
+  {
+    texture->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS, qPrintable(key.ArrayName));
+  }
+  texture->SetColorMode(key.MapScalars ? VTK_COLOR_MODE_MAP_SCALARS : VTK_COLOR_MODE_DIRECT_SCALARS);
+
+  if(nullptr != lookupTable)
+  {
+    VTK_NEW(vtkColorTransferFunction, lookupTableCopy);
+    lookupTableCopy->DeepCopy(lookupTable);
+    if(key.Component < 0)
+    {
+      lookupTableCopy->SetVectorModeToMagnitude();
+    }
+    else
+    {
+      lookupTableCopy->SetVectorModeToComponent();
+      lookupTableCopy->SetVectorComponent(key.Component);
+    }
+    texture->SetLookupTable(lookupTableCopy);
+  }
+
+  m_Textures[key] = texture;
+  return texture;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureCache::pruneUnusedTextures()
+{
+  for(auto iter = m_Textures.begin(); iter != m_Textures.end();)
+  {
+    // Only the cache holds a reference
+    if(iter->second->GetReferenceCount() <= 1)
+    {
+      iter = m_Textures.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  // Grow the threshold with the number of textures in use to keep pruning amortized
+  m_PruneSize = std::max<size_t>(64, 2 * m_Textures.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureCache::releaseTexture(const Key& key)
+{
+  if(nullptr == key.DataSet)
+  {
+    return;
+  }
+
+  QMutexLocker locker(&m_Lock);
+  auto iter = m_Textures.find(key);
+  // Only the cache holds a reference
+  if(iter != m_Textures.end() && iter->second->GetReferenceCount() <= 1)
+  {
+    m_Textures.erase(iter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureCache::releaseDataSet(vtkImageData* dataSet)
+{
+  QMutexLocker locker(&m_Lock);
+  for(auto iter = m_Textures.begin(); iter != m_Textures.end();)
+  {
+    if(iter->first.DataSet == dataSet)
+    {
+      iter = m_Textures.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTextureCache::clear()
+{
+  QMutexLocker locker(&m_Lock);
+  m_Textures.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSTextureCache::size()
+{
+  QMutexLocker locker(&m_Lock);
+  return m_Textures.size();
+}
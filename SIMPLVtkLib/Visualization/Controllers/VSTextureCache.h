@@ -0,0 +1,150 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+#include <vtkImageData.h>
+#include <vtkTexture.h>
+#include <vtkType.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkColorTransferFunction;
+
+/**
+ * @class VSTextureCache VSTextureCache.h
+ * SIMPLVtkLib/Visualization/Controllers/VSTextureCache.h
+ * @brief This class stores the vtkTextures used to display flat images so that
+ * VSFilterViewSettings in different views can share a single texture when they
+ * show the same image in the same way.  Textures are keyed on the source image,
+ * color array, component, subsampling rate, color mode, and the contents of the
+ * lookup table.  Each texture owns a copy of the lookup table it was created
+ * with so that later changes to a view's lookup table do not affect other views.
+ */
+class SIMPLVtkLib_EXPORT VSTextureCache
+{
+public:
+  struct Key
+  {
+    vtkImageData* DataSet = nullptr;
+    vtkMTimeType DataSetTime = 0;
+    QString ArrayName;
+    int Component = -1;
+    int Subsampling = 1;
+    bool MapScalars = true;
+    std::vector<double> LookupTable;
+
+    bool operator<(const Key& other) const;
+    bool operator==(const Key& other) const;
+    bool operator!=(const Key& other) const;
+  };
+
+  /**
+   * @brief Returns the cache shared by all views
+   * @return
+   */
+  static VSTextureCache* Instance();
+
+  /**
+   * @brief Creates a key for the given source image and display settings.  The
+   * lookup table contents are copied into the key.
+   * @param dataSet
+   * @param arrayName
+   * @param component
+   * @param subsampling
+   * @param mapScalars
+   * @param lookupTable
+   * @return
+   */
+  static Key CreateKey(vtkImageData* dataSet, const QString& arrayName, int component, int subsampling, bool mapScalars, vtkColorTransferFunction* lookupTable);
+
+  /**
+   * @brief Returns the texture for the given key.  The texture is created from
+   * the given image and lookup table if it is not already cached.  The image
+   * should be the key's source image at the key's subsampling rate.
+   * @param key
+   * @param image
+   * @param lookupTable
+   * @return
+   */
+  VTK_PTR(vtkTexture) getTexture(const Key& key, vtkImageData* image, vtkColorTransferFunction* lookupTable);
+
+  /**
+   * @brief Removes the texture for the given key if no view still uses it.  Callers
+   * should drop their own reference to the texture first.
+   * @param key
+   */
+  void releaseTexture(const Key& key);
+
+  /**
+   * @brief Removes all textures created from the given source image
+   * @param dataSet
+   */
+  void releaseDataSet(vtkImageData* dataSet);
+
+  /**
+   * @brief Removes all cached textures
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of cached textures
+   * @return
+   */
+  size_t size();
+
+protected:
+  VSTextureCache() = default;
+
+  /**
+   * @brief Removes textures that are no longer used by any view.  Requires the
+   * cache lock to be held.
+   */
+  void pruneUnusedTextures();
+
+private:
+  std::map<Key, VTK_PTR(vtkTexture)> m_Textures;
+  size_t m_PruneSize = 64;
+  QMutex m_Lock;
+};
@@ -20,6 +20,7 @@ set(VSVisualFilters
   VSDataSetFilter
   VSFileNameFilter
   VSMaskFilter
+  VSParallelAlgorithm
   VSPipelineFilter
   VSRootFilter
   VSSIMPLDataContainerFilter
@@ -70,7 +70,7 @@ public:
   /**
    * @brief Reloads the data in the item
    */
-  virtual void reloadData();
+  Q_INVOKABLE virtual void reloadData();
 
   /**
    * @brief Returns true if the data has been imported.  Returns false otherwise.
@@ -99,6 +99,8 @@ public:
 
 signals:
   void dataReloaded();
+  void dataEvicted();
+  void dataRestored();
   void filterReloaded(VSAbstractFilter* filter);
 
 protected:
@@ -35,15 +35,27 @@
 
 #include "VSAbstractFilter.h"
 
+#include <QtConcurrent>
 #include <QtCore/QCoreApplication>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QString>
 #include <QtCore/QThread>
 
+#include <algorithm>
+#include <cmath>
+
 #include <vtkAlgorithm.h>
+#include <vtkCallbackCommand.h>
 #include <vtkCellData.h>
+#include <vtkCommand.h>
+#include <vtkExtractCells.h>
+#include <vtkExtractVOI.h>
 #include <vtkGenericDataObjectWriter.h>
+#include <vtkIdList.h>
+#include <vtkImageData.h>
 #include <vtkPointData.h>
 #include <vtkPointSet.h>
+#include <vtkPolyData.h>
 
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSVertexGeom.h"
@@ -52,6 +64,65 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VtkWidgets/VSAbstractWidget.h"
 
+namespace
+{
+// Preview inputs are decimated to roughly this many cells
+const vtkIdType s_PreviewCellCount = 262144;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) CreatePreviewProxy(const VTK_PTR(vtkDataSet)& input)
+{
+  const double reduction = static_cast<double>(input->GetNumberOfCells()) / s_PreviewCellCount;
+  if(reduction <= 1.0)
+  {
+    VTK_NEW(vtkTrivialProducer, producer);
+    producer->SetOutput(input);
+    return producer;
+  }
+
+  // Images are strided evenly along each axis that has more than one cell
+  vtkImageData* imageData = vtkImageData::SafeDownCast(input);
+  if(imageData)
+  {
+    int extent[6];
+    imageData->GetExtent(extent);
+    int numAxes = 0;
+    for(int i = 0; i < 3; i++)
+    {
+      if(extent[2 * i + 1] - extent[2 * i] > 1)
+      {
+        numAxes++;
+      }
+    }
+
+    int sampleRate = static_cast<int>(std::ceil(std::pow(reduction, 1.0 / std::max(numAxes, 1))));
+    VTK_NEW(vtkExtractVOI, extractVOI);
+    extractVOI->SetInputData(input);
+    extractVOI->SetVOI(extent);
+    extractVOI->SetSampleRate(sampleRate, sampleRate, sampleRate);
+    extractVOI->IncludeBoundaryOn();
+    return extractVOI;
+  }
+
+  // Other data sets keep an evenly spaced subset of their cells
+  const vtkIdType stride = static_cast<vtkIdType>(std::ceil(reduction));
+  const vtkIdType numCells = input->GetNumberOfCells();
+  VTK_NEW(vtkIdList, cellIds);
+  cellIds->SetNumberOfIds((numCells + stride - 1) / stride);
+  for(vtkIdType i = 0; i < cellIds->GetNumberOfIds(); i++)
+  {
+    cellIds->SetId(i, i * stride);
+  }
+
+  VTK_NEW(vtkExtractCells, extractCells);
+  extractCells->SetInputData(input);
+  extractCells->SetCellList(cellIds);
+  return extractCells;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -61,6 +132,8 @@ VSAbstractFilter::VSAbstractFilter()
 , m_Transform(new VSTransform())
 , m_ChildLock(1)
 , m_InputPort(nullptr)
+, m_ApplyWatcher(this)
+, m_CancelApply(false)
 {
   setCheckable(true);
   setChecked(true);
@@ -71,6 +144,16 @@ VSAbstractFilter::VSAbstractFilter()
   m_Transform->moveToThread(thread);
 
   connect(this, SIGNAL(updatedOutputPort(VSAbstractFilter*)), this, SLOT(connectAdditionalOutputFilters(VSAbstractFilter*)));
+  connect(&m_ApplyWatcher, SIGNAL(finished()), this, SLOT(finishApply()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::~VSAbstractFilter()
+{
+  cancelApply();
+  m_ApplyWatcher.waitForFinished();
 }
 
 // -----------------------------------------------------------------------------
@@ -236,7 +319,9 @@ void VSAbstractFilter::addChild(VSAbstractFilter* child)
   if(model)
   {
     model->beginInsertingFilter(this);
+    m_ChildIndices[child] = static_cast<int>(m_Children.size());
     m_Children.push_back(child);
+    invalidateDescendants();
     model->endInsertingFilter(child);
   }
   m_ChildLock.release();
@@ -255,12 +340,35 @@ void VSAbstractFilter::removeChild(VSAbstractFilter* child)
   if(model)
   {
     model->beginRemovingFilter(this, row);
-    m_Children.remove(child);
+    if(row >= 0)
+    {
+      m_Children.erase(m_Children.begin() + row);
+      m_ChildIndices.erase(child);
+
+      // Only the children after the removed one change position
+      for(int i = row; i < static_cast<int>(m_Children.size()); i++)
+      {
+        m_ChildIndices[m_Children[i]] = i;
+      }
+    }
+    invalidateDescendants();
     model->endRemovingFilter(child);
   }
   m_ChildLock.release();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::invalidateDescendants()
+{
+  for(VSAbstractFilter* filter = this; nullptr != filter; filter = filter->getParentFilter())
+  {
+    QMutexLocker locker(&filter->m_DescendantsLock);
+    filter->m_DescendantsValid = false;
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -278,6 +386,14 @@ VSAbstractFilter* VSAbstractFilter::getAncestor()
 //
 // -----------------------------------------------------------------------------
 VSAbstractFilter::FilterListType VSAbstractFilter::getChildren() const
+{
+  return FilterListType(m_Children.begin(), m_Children.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const VSAbstractFilter::ChildListType& VSAbstractFilter::getChildList() const
 {
   return m_Children;
 }
@@ -287,7 +403,7 @@ VSAbstractFilter::FilterListType VSAbstractFilter::getChildren() const
 // -----------------------------------------------------------------------------
 int VSAbstractFilter::getChildCount() const
 {
-  return m_Children.size();
+  return static_cast<int>(m_Children.size());
 }
 
 // -----------------------------------------------------------------------------
@@ -300,17 +416,13 @@ int VSAbstractFilter::getIndexOfChild(const VSAbstractFilter* childFilter) const
     return -1;
   }
 
-  int i = 0;
-  for(auto iter = m_Children.cbegin(); iter != m_Children.cend(); iter++)
+  auto iter = m_ChildIndices.find(childFilter);
+  if(iter == m_ChildIndices.end())
   {
-    if(childFilter == (*iter))
-    {
-      return i;
-    }
-    i++;
+    return -1;
   }
 
-  return -1;
+  return iter->second;
 }
 
 // -----------------------------------------------------------------------------
@@ -318,18 +430,24 @@ int VSAbstractFilter::getIndexOfChild(const VSAbstractFilter* childFilter) const
 // -----------------------------------------------------------------------------
 VSAbstractFilter::FilterListType VSAbstractFilter::getDescendants() const
 {
-  FilterListType descendants;
-  FilterListType children = getChildren();
+  // Import worker threads also request descendants.  Locks are only nested from parent to child.
+  QMutexLocker locker(&m_DescendantsLock);
+  if(m_DescendantsValid)
+  {
+    return m_Descendants;
+  }
 
-  for(VSAbstractFilter* filter : children)
+  m_Descendants.clear();
+  for(VSAbstractFilter* filter : m_Children)
   {
-    descendants.push_back(filter);
+    m_Descendants.push_back(filter);
     FilterListType filterDescendants = filter->getDescendants();
 
-    descendants.insert(descendants.end(), filterDescendants.begin(), filterDescendants.end());
+    m_Descendants.insert(m_Descendants.end(), filterDescendants.begin(), filterDescendants.end());
   }
+  m_DescendantsValid = true;
 
-  return descendants;
+  return m_Descendants;
 }
 
 // -----------------------------------------------------------------------------
@@ -342,13 +460,7 @@ VSAbstractFilter* VSAbstractFilter::getChild(int index) const
     return nullptr;
   }
 
-  auto iter = m_Children.begin();
-  for(int i = 0; i < index; i++)
-  {
-    iter++;
-  }
-
-  return (*iter);
+  return m_Children[index];
 }
 
 // -----------------------------------------------------------------------------
@@ -374,6 +486,13 @@ bool VSAbstractFilter::isPointData() const
     return true;
   }
 
+  // Natively wrapped VertexGeoms only contain vertex cells
+  vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataSet);
+  if(polyData && polyData->GetNumberOfVerts() > 0 && polyData->GetNumberOfVerts() == polyData->GetNumberOfCells())
+  {
+    return true;
+  }
+
   return false;
 }
 
@@ -398,6 +517,15 @@ QStringList VSAbstractFilter::getArrayNames()
       {
         arrayNames.push_back(dataSet->GetPointData()->GetArrayName(i));
       }
+
+      // Cell arrays are only interpolated to point data once they are requested
+      for(const QString& lazyName : getLazyPointDataArrayNames())
+      {
+        if(!arrayNames.contains(lazyName))
+        {
+          arrayNames.push_back(lazyName);
+        }
+      }
     }
     else
     {
@@ -437,6 +565,16 @@ QStringList VSAbstractFilter::getScalarNames()
           arrayNames.push_back(dataArray->GetName());
         }
       }
+
+      // Interpolated point arrays have as many components as their cell arrays
+      for(const QString& lazyName : getLazyPointDataArrayNames())
+      {
+        vtkDataArray* cellArray = dataSet->GetCellData()->GetArray(qPrintable(lazyName));
+        if(cellArray && cellArray->GetNumberOfComponents() == 1 && !arrayNames.contains(lazyName))
+        {
+          arrayNames.push_back(lazyName);
+        }
+      }
     }
     else
     {
@@ -480,7 +618,53 @@ VTK_PTR(vtkDataArray) VSAbstractFilter::getDataArray(QString arrayName) const
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double* VSAbstractFilter::getArrayValueRange(QString arrayName) const
+VTK_PTR(vtkDataArray) VSAbstractFilter::getPointDataArray(const QString& arrayName)
+{
+  VTK_PTR(vtkDataSet) dataSet = getOutput();
+  if(nullptr == dataSet)
+  {
+    return nullptr;
+  }
+
+  VTK_PTR(vtkDataArray) pointArray = dataSet->GetPointData()->GetArray(qPrintable(arrayName));
+  if(pointArray || nullptr == getParentFilter())
+  {
+    return pointArray;
+  }
+
+  if(nullptr == getParentFilter()->getPointDataArray(arrayName))
+  {
+    return nullptr;
+  }
+
+  // Filters without an applied output pass the parent's output through
+  dataSet = getOutput();
+  pointArray = dataSet->GetPointData()->GetArray(qPrintable(arrayName));
+  if(nullptr == pointArray && hasAppliedOutput() && !isApplying())
+  {
+    startApply();
+  }
+
+  return pointArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList VSAbstractFilter::getLazyPointDataArrayNames() const
+{
+  if(nullptr == getParentFilter())
+  {
+    return QStringList();
+  }
+
+  return getParentFilter()->getLazyPointDataArrayNames();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayStatistics::StatisticsPtr VSAbstractFilter::getArrayStatistics(QString arrayName) const
 {
   if(nullptr == getDataSetFilter())
   {
@@ -488,13 +672,21 @@ double* VSAbstractFilter::getArrayValueRange(QString arrayName) const
   }
 
   VTK_PTR(vtkDataArray) dataArray = getDataSetFilter()->getDataArray(arrayName);
-  if(dataArray)
+  return VSArrayStatistics::Instance()->getStatistics(dataArray);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::getArrayValueRange(QString arrayName, double range[2]) const
+{
+  VSArrayStatistics::StatisticsPtr statistics = getArrayStatistics(arrayName);
+  if(nullptr == statistics)
   {
-    qDebug() << dataArray->GetName() << ": " << dataArray->GetRange()[0] << ", " << dataArray->GetRange()[1];
-    return dataArray->GetRange();
+    return false;
   }
 
-  return nullptr;
+  return statistics->getRange(0, range);
 }
 
 // -----------------------------------------------------------------------------
@@ -502,8 +694,8 @@ double* VSAbstractFilter::getArrayValueRange(QString arrayName) const
 // -----------------------------------------------------------------------------
 double VSAbstractFilter::getArrayMinValue(QString arrayName) const
 {
-  double* range = getArrayValueRange(arrayName);
-  if(range != nullptr)
+  double range[2];
+  if(getArrayValueRange(arrayName, range))
   {
     return range[0];
   }
@@ -516,8 +708,8 @@ double VSAbstractFilter::getArrayMinValue(QString arrayName) const
 // -----------------------------------------------------------------------------
 double VSAbstractFilter::getArrayMaxValue(QString arrayName) const
 {
-  double* range = getArrayValueRange(arrayName);
-  if(range != nullptr)
+  double range[2];
+  if(getArrayValueRange(arrayName, range))
   {
     return range[1];
   }
@@ -897,9 +1089,12 @@ void VSAbstractFilter::writeJson(QJsonObject& json)
   QJsonArray localScaleArray;
 
   VSTransform* transform = getTransform();
-  double* localPos = transform->getLocalPosition();
-  double* localRot = transform->getLocalRotation();
-  double* localScale = transform->getLocalScale();
+  double localPos[3];
+  double localRot[3];
+  double localScale[3];
+  transform->getLocalPosition(localPos);
+  transform->getLocalRotation(localRot);
+  transform->getLocalScale(localScale);
 
   for(int i = 0; i < 3; i++)
   {
@@ -908,10 +1103,6 @@ void VSAbstractFilter::writeJson(QJsonObject& json)
     localScaleArray.push_back(localScale[i]);
   }
 
-  delete[] localPos;
-  delete[] localRot;
-  delete[] localScale;
-
   transformObject["LocalPosition"] = localPositionArray;
   transformObject["LocalRotation"] = localRotationArray;
   transformObject["LocalScale"] = localScaleArray;
@@ -1190,4 +1381,286 @@ QJsonObject VSAbstractFilter::getLoadingObject() const
   return m_LoadingObject;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) VSAbstractFilter::createApplyAlgorithm()
+{
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isApplying() const
+{
+  return m_ApplyWatcher.isRunning();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::cancelApply()
+{
+  QMutexLocker locker(&m_ApplyLock);
+  m_CancelApply = true;
+  m_PendingAlgorithm = nullptr;
+  if(m_ApplyAlgorithm)
+  {
+    m_ApplyAlgorithm->AbortExecuteOn();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::waitForApply()
+{
+  // Finishing may restart the apply with newer values, so wait until none are left
+  do
+  {
+    m_ApplyWatcher.waitForFinished();
+    finishApply();
+  } while(m_ApplyWatcher.isRunning());
 
+  QMutexLocker locker(&m_ApplyLock);
+  return !m_CancelApply && m_ApplyFuture.resultCount() > 0 && m_ApplyFuture.result() != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::startApply()
+{
+  if(nullptr == getParentFilter())
+  {
+    return;
+  }
+
+  runApply(createApplyAlgorithm(), false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::startPreview(VTK_PTR(vtkAlgorithm) algorithm)
+{
+  if(nullptr == getParentFilter())
+  {
+    return;
+  }
+
+  runApply(algorithm, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::runApply(VTK_PTR(vtkAlgorithm) algorithm, bool preview)
+{
+  if(nullptr == algorithm)
+  {
+    return;
+  }
+
+  if(m_ApplyWatcher.isRunning())
+  {
+    // Start the newest algorithm once the running one stops
+    cancelApply();
+    m_PendingAlgorithm = algorithm;
+    m_PendingPreview = preview;
+    return;
+  }
+
+  VSAbstractFilter* parentFilter = getParentFilter();
+  vtkAlgorithmOutput* parentPort = parentFilter->getOutputPort();
+  if(parentPort && parentPort->GetProducer())
+  {
+    parentPort->GetProducer()->Update(parentPort->GetIndex());
+  }
+  VTK_PTR(vtkDataSet) parentOutput = parentFilter->getOutput();
+  if(nullptr == parentOutput)
+  {
+    return;
+  }
+
+  if(preview)
+  {
+    algorithm->SetInputConnection(getPreviewInputPort(parentOutput));
+  }
+  else
+  {
+    // The worker reads a copy of the parent output so that it does not share pipeline objects with the renderer
+    VTK_PTR(vtkDataSet) input = VTK_PTR(vtkDataSet)::Take(parentOutput->NewInstance());
+    input->ShallowCopy(parentOutput);
+    algorithm->SetInputDataObject(input);
+  }
+
+  VTK_NEW(vtkCallbackCommand, progressCallback);
+  progressCallback->SetCallback(&VSAbstractFilter::ApplyProgressCallback);
+  progressCallback->SetClientData(this);
+  algorithm->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+
+  if(nullptr == m_AppliedOutput)
+  {
+    m_AppliedOutput = VTK_PTR(vtkTrivialProducer)::New();
+  }
+
+  QMutexLocker locker(&m_ApplyLock);
+  m_CancelApply = false;
+  m_ApplyAlgorithm = algorithm;
+  m_ApplyPreview = preview;
+  m_ApplyFuture = QtConcurrent::run(&VSAbstractFilter::RunApplyAlgorithm, algorithm);
+  m_ApplyWatcher.setFuture(m_ApplyFuture);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSAbstractFilter::RunApplyAlgorithm(VTK_PTR(vtkAlgorithm) algorithm)
+{
+  algorithm->Update();
+  if(algorithm->GetAbortExecute())
+  {
+    return nullptr;
+  }
+
+  return vtkDataSet::SafeDownCast(algorithm->GetOutputDataObject(0));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::finishApply()
+{
+  VTK_PTR(vtkDataSet) output = nullptr;
+  bool canceled = false;
+  bool preview = false;
+  {
+    QMutexLocker locker(&m_ApplyLock);
+    if(nullptr == m_ApplyAlgorithm)
+    {
+      // Already handled by waitForApply()
+      return;
+    }
+
+    if(m_ApplyFuture.resultCount() > 0)
+    {
+      output = m_ApplyFuture.result();
+    }
+    canceled = m_CancelApply;
+    preview = m_ApplyPreview;
+    m_ApplyAlgorithm = nullptr;
+  }
+
+  if(m_PendingAlgorithm)
+  {
+    VTK_PTR(vtkAlgorithm) pendingAlgorithm = m_PendingAlgorithm;
+    m_PendingAlgorithm = nullptr;
+    runApply(pendingAlgorithm, m_PendingPreview);
+    return;
+  }
+
+  if(canceled || nullptr == output)
+  {
+    if(false == preview)
+    {
+      emit applyFinished(false);
+    }
+    return;
+  }
+
+  m_AppliedOutput->SetOutput(output);
+  m_AppliedOutput->Update();
+  m_HasAppliedOutput = true;
+  m_ShowingPreview = preview;
+
+  emit updatedOutputPort(this);
+  if(false == preview)
+  {
+    emit applyFinished(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::ApplyProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  VSAbstractFilter* filter = static_cast<VSAbstractFilter*>(clientData);
+  vtkAlgorithm* algorithm = vtkAlgorithm::SafeDownCast(caller);
+  if(nullptr == filter || nullptr == algorithm)
+  {
+    return;
+  }
+
+  if(filter->m_CancelApply)
+  {
+    algorithm->AbortExecuteOn();
+    return;
+  }
+
+  int percent = static_cast<int>(algorithm->GetProgress() * 100.0);
+  emit filter->applyProgress(percent);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSAbstractFilter::getPreviewInputPort(const VTK_PTR(vtkDataSet)& parentOutput)
+{
+  if(m_PreviewProxy && m_PreviewSource == parentOutput && m_PreviewSourceTime == parentOutput->GetMTime())
+  {
+    return m_PreviewProxy->GetOutputPort();
+  }
+
+  VTK_PTR(vtkDataSet) input = VTK_PTR(vtkDataSet)::Take(parentOutput->NewInstance());
+  input->ShallowCopy(parentOutput);
+
+  m_PreviewProxy = ::CreatePreviewProxy(input);
+  m_PreviewSource = parentOutput;
+  m_PreviewSourceTime = parentOutput->GetMTime();
+  return m_PreviewProxy->GetOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isPreviewing() const
+{
+  return m_ShowingPreview;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::hasAppliedOutput() const
+{
+  return m_HasAppliedOutput;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSAbstractFilter::getAppliedOutputPort() const
+{
+  if(nullptr == m_AppliedOutput)
+  {
+    return nullptr;
+  }
+
+  return m_AppliedOutput->GetOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSAbstractFilter::getAppliedOutput() const
+{
+  if(false == m_HasAppliedOutput)
+  {
+    return nullptr;
+  }
+
+  return vtkDataSet::SafeDownCast(m_AppliedOutput->GetOutputDataObject(0));
+}
@@ -39,7 +39,10 @@
 #pragma GCC diagnostic ignored "-Winconsistent-missing-override"
 #endif
 
+#include <atomic>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <vtkAlgorithmOutput.h>
 #include <vtkDataArray.h>
@@ -47,9 +50,12 @@
 #include <vtkTransformFilter.h>
 #include <vtkTrivialProducer.h>
 
+#include <QtCore/QFuture>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QSemaphore>
 #include <QtCore/QString>
@@ -59,6 +65,7 @@
 #include <QtGui/QStandardItemModel>
 
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayStatistics.h"
 #include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSTransform.h"
 
@@ -108,6 +115,7 @@ public:
     Pipeline
   };
   using FilterListType = std::list<VSAbstractFilter*>;
+  using ChildListType = std::vector<VSAbstractFilter*>;
     /**
     * @brief Setter property for LoadingObject
     */
@@ -121,9 +129,9 @@ public:
   void setInitialized(bool value);
   bool getInitialized() const;
   /**
-   * @brief Deconstructor
+   * @brief Deconstructor.  Cancels and waits for any apply in progress.
    */
-  virtual ~VSAbstractFilter() = default;
+  virtual ~VSAbstractFilter();
   /**
    * @brief Deletes the item and removes it from the model
    */
@@ -189,6 +197,13 @@ public:
    */
   FilterListType getChildren() const;
 
+  /**
+   * @brief Returns the children filters without copying them.  The reference is
+   * only valid until a child is added or removed.
+   * @return
+   */
+  const ChildListType& getChildList() const;
+
   /**
    * @brief Returns the number of children this filter has
    * @return
@@ -217,7 +232,8 @@ public:
   virtual QString getInfoString(SIMPL::InfoStringFormat format) const = 0;
 
   /**
-   * @brief Returns a vector of all descendant filters
+   * @brief Returns a vector of all descendant filters.  The list is cached until
+   * a filter is added to or removed from this part of the tree.
    * @return
    */
   FilterListType getDescendants() const;
@@ -230,11 +246,37 @@ public:
   VTK_PTR(vtkDataArray) getDataArray(QString arrayName) const;
 
   /**
-   * @brief Returns the range of values for the given array
+   * @brief Returns the point array with the given name.  Point arrays that have not been
+   * interpolated from cell data yet are requested from the parent filter.  Applied filters
+   * are re-applied when their input gains the array, in which case nullptr is returned until
+   * updatedOutputPort is emitted.
+   * @param arrayName
+   * @return
+   */
+  virtual VTK_PTR(vtkDataArray) getPointDataArray(const QString& arrayName);
+
+  /**
+   * @brief Returns the names of cell arrays that can be interpolated to point data on request
+   * but have not been yet
+   * @return
+   */
+  virtual QStringList getLazyPointDataArrayNames() const;
+
+  /**
+   * @brief Copies the cached range of values for the given array into range.
+   * Returns false if the array does not exist.
+   * @param arrayName
+   * @param range
+   * @return
+   */
+  bool getArrayValueRange(QString arrayName, double range[2]) const;
+
+  /**
+   * @brief Returns the cached ranges and histogram for the given array
    * @param arrayName
    * @return
    */
-  double* getArrayValueRange(QString arrayName) const;
+  VSArrayStatistics::StatisticsPtr getArrayStatistics(QString arrayName) const;
 
   /**
    * @brief Returns the minimum value for the given array
@@ -429,6 +471,32 @@ public:
 
   virtual VSAbstractFilterValues* getValues() = 0;
 
+  /**
+   * @brief Returns true if the filter is computing its output on a worker thread.
+   * Returns false otherwise.
+   * @return
+   */
+  bool isApplying() const;
+
+  /**
+   * @brief Aborts the apply in progress.  The previous output is kept.
+   */
+  void cancelApply();
+
+  /**
+   * @brief Blocks until the apply in progress finishes and its output is available.
+   * Returns true if the output was updated.  Returns false if it was canceled or failed.
+   * @return
+   */
+  bool waitForApply();
+
+  /**
+   * @brief Returns true if the current output was computed from the decimated preview
+   * input rather than the full resolution parent output.  Returns false otherwise.
+   * @return
+   */
+  bool isPreviewing() const;
+
   //////////////////
   // Filter Lists //
   //////////////////
@@ -446,6 +514,8 @@ signals:
   void scalarNamesChanged();
   void dataImported();
   void filterNameChanged();
+  void applyProgress(int percent);
+  void applyFinished(bool success);
 
 protected slots:
   /**
@@ -466,6 +536,11 @@ protected slots:
    */
   void updateTransformFilter();
 
+  /**
+   * @brief Swaps in the output computed by the finished apply and notifies any listeners
+   */
+  void finishApply();
+
 protected:
   /**
    * @brief Constructor
@@ -561,6 +636,48 @@ protected:
    */
   void setEditable(bool editable);
 
+  /**
+   * @brief Returns a new vtkAlgorithm configured with the filter's current values and
+   * no input.  Filters that return nullptr do not support applying on a worker thread.
+   * @return
+   */
+  virtual VTK_PTR(vtkAlgorithm) createApplyAlgorithm();
+
+  /**
+   * @brief Runs createApplyAlgorithm() on a worker thread over a copy of the parent
+   * filter's output.  The previous output remains available until the new one is
+   * finished and updatedOutputPort is emitted.  Applying while another apply is in
+   * progress aborts the older one and starts again with the newest values.
+   */
+  void startApply();
+
+  /**
+   * @brief Runs the given algorithm on a worker thread over a cached, decimated copy of
+   * the parent filter's output.  Used for interactive previews while a widget is being
+   * dragged; the preview output is replaced by the next startApply().
+   * @param algorithm
+   */
+  void startPreview(VTK_PTR(vtkAlgorithm) algorithm);
+
+  /**
+   * @brief Returns true if an apply has finished and its output is available.
+   * Returns false otherwise.
+   * @return
+   */
+  bool hasAppliedOutput() const;
+
+  /**
+   * @brief Returns the output port for the output of the last finished apply
+   * @return
+   */
+  vtkAlgorithmOutput* getAppliedOutputPort() const;
+
+  /**
+   * @brief Returns the output of the last finished apply
+   * @return
+   */
+  VTK_PTR(vtkDataSet) getAppliedOutput() const;
+
 private:
     QJsonObject m_LoadingObject = {};
 
@@ -576,19 +693,76 @@ private:
    */
   void removeChild(VSAbstractFilter* child);
 
+  /**
+   * @brief Marks the cached descendants of this filter and its ancestors as out of date
+   */
+  void invalidateDescendants();
+
+  /**
+   * @brief Starts running the algorithm on a worker thread or queues it behind the
+   * apply in progress
+   * @param algorithm
+   * @param preview
+   */
+  void runApply(VTK_PTR(vtkAlgorithm) algorithm, bool preview);
+
+  /**
+   * @brief Returns the output port of the decimated copy of the given parent output.
+   * The copy is rebuilt only when the parent output changes.
+   * @param parentOutput
+   * @return
+   */
+  vtkAlgorithmOutput* getPreviewInputPort(const VTK_PTR(vtkDataSet)& parentOutput);
+
+  /**
+   * @brief Updates the algorithm and returns its output.  Called on a worker thread.
+   * @param algorithm
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) RunApplyAlgorithm(VTK_PTR(vtkAlgorithm) algorithm);
+
+  /**
+   * @brief vtkCommand::ProgressEvent callback for the algorithm being applied
+   * @param caller
+   * @param eventId
+   * @param clientData
+   * @param callData
+   */
+  static void ApplyProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData);
+
   std::shared_ptr<VSTransform> m_Transform;
   VTK_PTR(vtkTransformFilter) m_TransformFilter;
   mutable QSemaphore m_ChildLock;
   bool m_ConnectedInput = false;
   VTK_PTR(vtkAlgorithmOutput) m_InputPort;
 
-  std::list<VSAbstractFilter*> m_Children;
+  ChildListType m_Children;
+  std::unordered_map<const VSAbstractFilter*, int> m_ChildIndices;
+  mutable FilterListType m_Descendants;
+  mutable bool m_DescendantsValid = false;
+  mutable QMutex m_DescendantsLock;
   bool m_Checked = false;
   QString m_Tooltip;
   QFont m_Font;
   Qt::ItemFlags m_Flags;
   QString m_DisplayText;
   bool m_Initialized = false;
+
+  VTK_PTR(vtkTrivialProducer) m_AppliedOutput;
+  bool m_HasAppliedOutput = false;
+  QFutureWatcher<VTK_PTR(vtkDataSet)> m_ApplyWatcher;
+  QFuture<VTK_PTR(vtkDataSet)> m_ApplyFuture;
+  VTK_PTR(vtkAlgorithm) m_ApplyAlgorithm;
+  mutable QMutex m_ApplyLock;
+  std::atomic_bool m_CancelApply;
+  bool m_ApplyPreview = false;
+  VTK_PTR(vtkAlgorithm) m_PendingAlgorithm;
+  bool m_PendingPreview = false;
+  bool m_ShowingPreview = false;
+
+  VTK_PTR(vtkAlgorithm) m_PreviewProxy;
+  VTK_PTR(vtkDataSet) m_PreviewSource;
+  vtkMTimeType m_PreviewSourceTime = 0;
 };
 
 #ifdef __clang__
@@ -35,8 +35,12 @@
 
 #include "VSAbstractFilterValues.h"
 
+#include <QtWidgets/QCheckBox>
+
 #include "VSAbstractFilter.h"
 
+#include "SIMPLVtkLib/Visualization/VtkWidgets/VSAbstractWidget.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -135,3 +139,69 @@ QWidget* VSAbstractFilterValues::createFilterWidget()
 {
   return new QWidget();
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilterValues::isLivePreviewEnabled() const
+{
+  return m_LivePreviewEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::setLivePreviewEnabled(bool enabled)
+{
+  if(m_LivePreviewEnabled == enabled)
+  {
+    return;
+  }
+
+  m_LivePreviewEnabled = enabled;
+  emit livePreviewEnabledChanged(enabled);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::previewValues()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::connectPreviewWidget(VSAbstractWidget* widget)
+{
+  connect(widget, &VSAbstractWidget::modified, this, [=] {
+    if(m_LivePreviewEnabled && widget->isInteracting())
+    {
+      previewValues();
+    }
+  });
+
+  // A single full resolution update runs once the widget is released
+  connect(widget, &VSAbstractWidget::interactionEnded, this, [=] {
+    if(m_LivePreviewEnabled)
+    {
+      applyValues();
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilterValues::connectLivePreviewCheckBox(QCheckBox* checkBox)
+{
+  checkBox->setChecked(m_LivePreviewEnabled);
+  checkBox->setToolTip("Preview the filter on decimated data while dragging the widget and apply it when the widget is released");
+
+  connect(checkBox, &QCheckBox::stateChanged, this, [=](int state) { setLivePreviewEnabled(Qt::Checked == state); });
+  connect(this, &VSAbstractFilterValues::livePreviewEnabledChanged, checkBox, [=](bool enabled) {
+    checkBox->blockSignals(true);
+    checkBox->setChecked(enabled);
+    checkBox->blockSignals(false);
+  });
+}
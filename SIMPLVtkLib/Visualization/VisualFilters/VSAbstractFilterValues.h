@@ -43,6 +43,9 @@
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
 
+class QCheckBox;
+class VSAbstractWidget;
+
 /**
  * @class VSAbstractFilterValues VSAbstractFilterValues.h
  * SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilterValues.h
@@ -112,8 +115,23 @@ public:
    */
   virtual QWidget* createFilterWidget();
 
+  /**
+   * @brief Returns true if dragging a widget previews the values on decimated data and
+   * releasing it applies them.  Returns false otherwise.
+   * @return
+   */
+  bool isLivePreviewEnabled() const;
+
+  /**
+   * @brief Sets whether or not dragging a widget previews the values on decimated data
+   * and releasing it applies them
+   * @param enabled
+   */
+  void setLivePreviewEnabled(bool enabled);
+
 signals:
   void alertChangesWaiting();
+  void livePreviewEnabledChanged(bool enabled);
 
 protected:
   VSAbstractFilterValues(VSAbstractFilter* filter);
@@ -130,8 +148,27 @@ protected:
    */
   vtkRenderWindowInteractor* getInteractor() const;
 
+  /**
+   * @brief Previews the current values on the selected filters.  Called while a
+   * connected widget is dragged with live preview enabled.
+   */
+  virtual void previewValues();
+
+  /**
+   * @brief Connects the widget's interaction signals for live preview
+   * @param widget
+   */
+  void connectPreviewWidget(VSAbstractWidget* widget);
+
+  /**
+   * @brief Keeps the check box and the live preview setting in sync
+   * @param checkBox
+   */
+  void connectLivePreviewCheckBox(QCheckBox* checkBox);
+
 private:
   VSAbstractFilter::FilterListType m_Selection;
   bool m_RenderingEnabled = true;
   vtkRenderWindowInteractor* m_Interactor = nullptr;
+  bool m_LivePreviewEnabled = false;
 };
@@ -41,11 +41,63 @@
 #include <QtCore/QString>
 #include <QtCore/QUuid>
 
+#include <vtkAbstractTransform.h>
 #include <vtkDoubleArray.h>
+#include <vtkPoints.h>
 #include <vtkUnstructuredGrid.h>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSClipValues.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Copies a plane or box clip function so that it can be read from a worker thread
+// while the original continues to be edited.
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImplicitFunction) CopyClipFunction(vtkImplicitFunction* clipFunction)
+{
+  VTK_PTR(vtkImplicitFunction) copy = nullptr;
+  if(vtkPlanes* planes = vtkPlanes::SafeDownCast(clipFunction))
+  {
+    VTK_NEW(vtkPlanes, planesCopy);
+    if(planes->GetPoints())
+    {
+      VTK_NEW(vtkPoints, points);
+      points->DeepCopy(planes->GetPoints());
+      planesCopy->SetPoints(points);
+    }
+    if(planes->GetNormals())
+    {
+      VTK_PTR(vtkDataArray) normals;
+      normals.TakeReference(planes->GetNormals()->NewInstance());
+      normals->DeepCopy(planes->GetNormals());
+      planesCopy->SetNormals(normals);
+    }
+    copy = planesCopy;
+  }
+  else if(vtkPlane* plane = vtkPlane::SafeDownCast(clipFunction))
+  {
+    VTK_NEW(vtkPlane, planeCopy);
+    planeCopy->SetOrigin(plane->GetOrigin());
+    planeCopy->SetNormal(plane->GetNormal());
+    copy = planeCopy;
+  }
+  else
+  {
+    return clipFunction;
+  }
+
+  if(clipFunction->GetTransform())
+  {
+    VTK_PTR(vtkAbstractTransform) transform;
+    transform.TakeReference(clipFunction->GetTransform()->MakeTransform());
+    transform->DeepCopy(clipFunction->GetTransform());
+    copy->SetTransform(transform);
+  }
+  return copy;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -90,7 +142,11 @@ VSClipFilter* VSClipFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
 void VSClipFilter::createFilter()
 {
   m_ClipAlgorithm = vtkSmartPointer<vtkTableBasedClipDataSet>::New();
-  m_ClipAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+
+  // createApplyAlgorithm gives each apply a copy with its own partition algorithm factory
+  m_ParallelAlgorithm = VTK_PTR(VSParallelAlgorithm)::New();
+  m_ParallelAlgorithm->SetOutputType(VTK_UNSTRUCTURED_GRID);
+  m_ParallelAlgorithm->SetAlgorithm(m_ClipAlgorithm);
   setConnectedInput(true);
 }
 
@@ -171,6 +227,41 @@ void VSClipFilter::applyValues(VSClipValues* values)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSClipFilter::previewValues(VSClipValues* values)
+{
+  if(nullptr == m_ClipAlgorithm)
+  {
+    createFilter();
+  }
+
+  VTK_NEW(vtkTableBasedClipDataSet, previewClip);
+  previewClip->SetValue(m_ClipAlgorithm->GetValue());
+  previewClip->SetInsideOut(values->isInverted());
+
+  switch(values->getClipType())
+  {
+  case ClipType::BOX:
+    previewClip->SetClipFunction(values->getBoxWidget()->getPlanes());
+    break;
+  case ClipType::PLANE:
+  {
+    VSPlaneWidget* planeWidget = values->getPlaneWidget();
+    VTK_NEW(vtkPlane, plane);
+    plane->SetOrigin(planeWidget->getOrigin());
+    plane->SetNormal(planeWidget->getNormal());
+    previewClip->SetClipFunction(plane);
+    break;
+  }
+  default:
+    return;
+  }
+
+  startPreview(previewClip);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -195,9 +286,7 @@ void VSClipFilter::apply(double origin[3], double normal[3], bool inverted)
 
   m_ClipAlgorithm->SetClipFunction(plane);
   m_ClipAlgorithm->SetInsideOut(inverted);
-  m_ClipAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  startApply();
   emit clipTypeChanged();
 }
 
@@ -223,9 +312,7 @@ void VSClipFilter::apply(VTK_PTR(vtkPlanes) planes, VTK_PTR(vtkTransform) transf
 
   m_ClipAlgorithm->SetClipFunction(planes);
   m_ClipAlgorithm->SetInsideOut(inverted);
-  m_ClipAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  startApply();
   emit clipTypeChanged();
 }
 
@@ -403,9 +490,9 @@ QUuid VSClipFilter::GetUuid()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSClipFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_ClipAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ClipAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -420,9 +507,9 @@ vtkAlgorithmOutput* VSClipFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSClipFilter::getOutput() const
 {
-  if(getConnectedInput() && m_ClipAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ClipAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -446,7 +533,8 @@ void VSClipFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_ClipAlgorithm)
   {
-    m_ClipAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Recompute the output from the parent filter's new output
+    startApply();
   }
   else
   {
@@ -454,6 +542,35 @@ void VSClipFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) VSClipFilter::createApplyAlgorithm()
+{
+  if(nullptr == m_ParallelAlgorithm)
+  {
+    return nullptr;
+  }
+
+  // Copy the parameters on the calling thread so that the worker never reads m_ClipAlgorithm
+  VTK_PTR(vtkImplicitFunction) clipFunction = ::CopyClipFunction(m_ClipAlgorithm->GetClipFunction());
+  int insideOut = m_ClipAlgorithm->GetInsideOut();
+  double value = m_ClipAlgorithm->GetValue();
+
+  auto factory = [clipFunction, insideOut, value]() -> VTK_PTR(vtkAlgorithm) {
+    VTK_NEW(vtkTableBasedClipDataSet, partitionClip);
+    partitionClip->SetClipFunction(clipFunction);
+    partitionClip->SetInsideOut(insideOut);
+    partitionClip->SetValue(value);
+    return partitionClip;
+  };
+
+  VTK_PTR(VSParallelAlgorithm) algorithm = m_ParallelAlgorithm->CreateCopy();
+  algorithm->SetAlgorithm(factory());
+  algorithm->SetAlgorithmFactory(factory);
+  return algorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -45,6 +45,7 @@
 #include <vtkTableBasedClipDataSet.h>
 #include <vtkTransform.h>
 
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSParallelAlgorithm.h"
 #include "SIMPLVtkLib/Visualization/VtkWidgets/VSBoxWidget.h"
 #include "SIMPLVtkLib/Visualization/VtkWidgets/VSPlaneWidget.h"
 
@@ -137,6 +138,13 @@ public:
    */
   void applyValues(VSClipValues* values);
 
+  /**
+   * @brief Clips a decimated copy of the input with the given values without
+   * changing the last applied values.  Used while the clip widget is being dragged.
+   * @param values
+   */
+  void previewValues(VSClipValues* values);
+
   /**
    * @brief Applies the clip filter using a plane with the given values
    * @param origin
@@ -249,8 +257,15 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns a copy of the configured algorithm to run on a worker thread
+   * @return
+   */
+  VTK_PTR(vtkAlgorithm) createApplyAlgorithm() override;
+
 private:
   VTK_PTR(vtkTableBasedClipDataSet) m_ClipAlgorithm;
+  VTK_PTR(VSParallelAlgorithm) m_ParallelAlgorithm;
   VSClipValues* m_ClipValues = nullptr;
 };
 
@@ -51,6 +51,8 @@ VSClipValues::VSClipValues(VSClipFilter* filter)
 
   connect(m_BoxWidget, &VSBoxWidget::modified, this, &VSClipValues::alertChangesWaiting);
   connect(m_PlaneWidget, &VSPlaneWidget::modified, this, &VSClipValues::alertChangesWaiting);
+  connectPreviewWidget(m_BoxWidget);
+  connectPreviewWidget(m_PlaneWidget);
 
   // Set the last applied plane to the default representation
   m_PlaneWidget->setUsePlaneNormal(m_PlaneWidget->getNormal());
@@ -77,6 +79,10 @@ VSClipValues::VSClipValues(const VSClipValues& values)
 , m_LastPlaneInverted(values.m_LastPlaneInverted)
 , m_FreshFilter(values.m_FreshFilter)
 {
+  setLivePreviewEnabled(values.isLivePreviewEnabled());
+  connectPreviewWidget(m_BoxWidget);
+  connectPreviewWidget(m_PlaneWidget);
+
   m_PlaneWidget->setUsePlaneNormal(values.m_PlaneWidget->getUsePlaneNormal());
   m_PlaneWidget->setUsePlaneOrigin(values.m_PlaneWidget->getUsePlaneOrigin());
 }
@@ -120,6 +126,22 @@ void VSClipValues::applyValues()
   m_FreshFilter = false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSClipValues::previewValues()
+{
+  VSAbstractFilter::FilterListType filters = getSelection();
+  for(VSAbstractFilter* filter : filters)
+  {
+    VSClipFilter* clipFilter = dynamic_cast<VSClipFilter*>(filter);
+    if(clipFilter)
+    {
+      clipFilter->previewValues(this);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -331,6 +353,7 @@ QWidget* VSClipValues::createFilterWidget()
   ui.setupUi(filterWidget);
   ui.insideOutCheckBox->setChecked(m_Inverted);
   ui.clipTypeComboBox->setCurrentIndex(static_cast<int>(getClipType()));
+  connectLivePreviewCheckBox(ui.livePreviewCheckBox);
 
   auto changeClipType = [=](int type, bool setType = true) {
     if(setType)
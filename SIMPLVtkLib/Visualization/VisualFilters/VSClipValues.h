@@ -260,6 +260,11 @@ signals:
   void lastBoxScaleChanged();
 
 protected:
+  /**
+   * @brief Previews the current clip widget's values on the selected filters
+   */
+  void previewValues() override;
+
   /**
    * @brief Updates value visualization
    */
@@ -88,7 +88,6 @@ void VSCropFilter::createFilter()
 {
   m_CropAlgorithm = vtkSmartPointer<vtkExtractVOI>::New();
   m_CropAlgorithm->IncludeBoundaryOn();
-  m_CropAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
 
   setConnectedInput(true);
 }
@@ -117,12 +116,11 @@ void VSCropFilter::apply(int voi[6], int sampleRate[3])
   // Save the applied values for resetting Crop-Type widgets
   m_CropAlgorithm->SetVOI(voi);
   m_CropAlgorithm->SetSampleRate(sampleRate);
-  m_CropAlgorithm->Update();
 
   m_CropValues->setLastVOI(voi);
   m_CropValues->setLastSampleRate(sampleRate);
 
-  emit updatedOutputPort(this);
+  startApply();
 }
 
 // -----------------------------------------------------------------------------
@@ -200,9 +198,9 @@ VSAbstractFilter::FilterType VSCropFilter::getFilterType() const
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSCropFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_CropAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_CropAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -217,9 +215,9 @@ vtkAlgorithmOutput* VSCropFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSCropFilter::getOutput() const
 {
-  if(getConnectedInput() && m_CropAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_CropAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -243,7 +241,8 @@ void VSCropFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_CropAlgorithm)
   {
-    m_CropAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Recompute the output from the parent filter's new output
+    startApply();
   }
   else
   {
@@ -251,6 +250,23 @@ void VSCropFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) VSCropFilter::createApplyAlgorithm()
+{
+  if(nullptr == m_CropAlgorithm)
+  {
+    return nullptr;
+  }
+
+  VTK_NEW(vtkExtractVOI, cropAlgorithm);
+  cropAlgorithm->SetVOI(m_CropAlgorithm->GetVOI());
+  cropAlgorithm->SetSampleRate(m_CropAlgorithm->GetSampleRate());
+  cropAlgorithm->SetIncludeBoundary(m_CropAlgorithm->GetIncludeBoundary());
+  return cropAlgorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
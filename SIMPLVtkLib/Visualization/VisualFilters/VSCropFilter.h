@@ -200,6 +200,12 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns a copy of the configured algorithm to run on a worker thread
+   * @return
+   */
+  VTK_PTR(vtkAlgorithm) createApplyAlgorithm() override;
+
 private:
   VTK_PTR(vtkExtractVOI) m_CropAlgorithm;
   VSCropValues* m_CropValues = nullptr;
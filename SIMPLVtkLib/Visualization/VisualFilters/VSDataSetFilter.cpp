@@ -35,25 +35,47 @@
 
 #include "VSDataSetFilter.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtConcurrent>
 #include <QtCore/QMimeDatabase>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
 #include <QtCore/QUuid>
 
+#include <vtkAppendFilter.h>
 #include <vtkBMPReader.h>
+#include <vtkCallbackCommand.h>
+#include <vtkCommand.h>
+#include <vtkCompositeDataIterator.h>
+#include <vtkCompositeDataSet.h>
 #include <vtkGenericDataObjectReader.h>
 #include <vtkImageData.h>
+#include <vtkImageReader2.h>
+#include <vtkInformation.h>
 #include <vtkJPEGReader.h>
 #include <vtkPNGReader.h>
 #include <vtkPolyData.h>
-#include <vtkPolyDataReader.h>
 #include <vtkRectilinearGrid.h>
-#include <vtkRectilinearGridReader.h>
 #include <vtkSTLReader.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkStructuredGrid.h>
-#include <vtkStructuredGridReader.h>
-#include <vtkStructuredPointsReader.h>
 #include <vtkTIFFReader.h>
-#include <vtkUnstructuredGridReader.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLImageDataReader.h>
+#include <vtkXMLMultiBlockDataReader.h>
+#include <vtkXMLPImageDataReader.h>
+#include <vtkXMLPPolyDataReader.h>
+#include <vtkXMLPRectilinearGridReader.h>
+#include <vtkXMLPStructuredGridReader.h>
+#include <vtkXMLPUnstructuredGridReader.h>
+#include <vtkXMLPolyDataReader.h>
+#include <vtkXMLRectilinearGridReader.h>
+#include <vtkXMLStructuredGridReader.h>
+#include <vtkXMLUnstructuredGridReader.h>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 
@@ -61,8 +83,20 @@
 //
 // -----------------------------------------------------------------------------
 VSDataSetFilter::VSDataSetFilter(const QString& filePath, VSAbstractFilter* parent)
+: VSDataSetFilter(filePath, ReadRegion(), parent)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSDataSetFilter::VSDataSetFilter(const QString& filePath, const ReadRegion& region, VSAbstractFilter* parent)
 : VSAbstractDataFilter()
 , m_FilePath(filePath)
+, m_ReadRegion(region)
+, m_LoadWatcher(this)
+, m_CancelLoad(false)
+, m_LoadStarted(false)
 {
   createFilter();
   setParentFilter(parent);
@@ -70,11 +104,42 @@ VSDataSetFilter::VSDataSetFilter(const QString& filePath, VSAbstractFilter* pare
   m_DataSetValues = new VSDataSetValues(this);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSDataSetFilter::~VSDataSetFilter()
+{
+  // The reader thread references this filter and must finish before it is destroyed
+  cancelLoad();
+  m_LoadWatcher.waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSDataSetFilter::ReadRegion::operator==(const ReadRegion& other) const
+{
+  return Piece == other.Piece && NumberOfPieces == other.NumberOfPieces && UseExtent == other.UseExtent && Extent == other.Extent;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSDataSetFilter::ReadRegion::operator!=(const ReadRegion& other) const
+{
+  return !(*this == other);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 double* VSDataSetFilter::getBounds() const
 {
+  if(nullptr == m_DataSet)
+  {
+    return nullptr;
+  }
+
   return m_DataSet->GetBounds();
 }
 
@@ -100,6 +165,19 @@ VTK_PTR(vtkDataSet) VSDataSetFilter::getOutput() const
 {
   if(nullptr == m_DataSet)
   {
+    // Filters created without an importer load their file when first used
+    if(!m_LoadStarted)
+    {
+      VSDataSetFilter* filter = const_cast<VSDataSetFilter*>(this);
+      if(QThread::currentThread() == thread())
+      {
+        filter->startLoading();
+      }
+      else
+      {
+        QMetaObject::invokeMethod(filter, "startLoading", Qt::QueuedConnection);
+      }
+    }
     return nullptr;
   }
 
@@ -111,21 +189,43 @@ VTK_PTR(vtkDataSet) VSDataSetFilter::getOutput() const
 // -----------------------------------------------------------------------------
 bool VSDataSetFilter::isFlatImage()
 {
-  QFileInfo fi(m_FilePath);
-  QString ext = fi.completeSuffix().toLower();
+  return m_MimeType.name().startsWith("image/");
+}
 
-  QMimeDatabase db;
-  QMimeType mimeType = db.mimeTypeForFile(m_FilePath, QMimeDatabase::MatchContent);
-  QString mimeName = mimeType.name();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSDataSetFilter::isLoading() const
+{
+  return m_LoadWatcher.isRunning();
+}
 
-  if(mimeType.name().startsWith("image/"))
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::cancelLoad()
+{
+  QMutexLocker locker(&m_LoadLock);
+  m_CancelLoad = true;
+  if(m_ActiveReader)
   {
-    return true;
+    m_ActiveReader->AbortExecuteOn();
   }
-  else
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSDataSetFilter::waitForLoad()
+{
+  QFuture<VTK_PTR(vtkDataSet)> future;
   {
-    return false;
+    QMutexLocker locker(&m_LoadLock);
+    future = m_LoadFuture;
   }
+
+  future.waitForFinished();
+  return !m_CancelLoad && future.resultCount() > 0 && future.result() != nullptr;
 }
 
 // -----------------------------------------------------------------------------
@@ -133,10 +233,33 @@ bool VSDataSetFilter::isFlatImage()
 // -----------------------------------------------------------------------------
 VSDataSetFilter* VSDataSetFilter::Create(const QString& filePath, QJsonObject& json, VSAbstractFilter* parent)
 {
-  VSDataSetFilter* filter = new VSDataSetFilter(filePath, parent);
+  ReadRegion region;
+  if(json.contains("ReadRegion"))
+  {
+    QJsonObject regionObj = json["ReadRegion"].toObject();
+    region.Piece = regionObj["Piece"].toInt(0);
+    region.NumberOfPieces = regionObj["NumberOfPieces"].toInt(1);
+    region.UseExtent = regionObj["UseExtent"].toBool(false);
+
+    QJsonArray extentArray = regionObj["Extent"].toArray();
+    if(extentArray.size() == 6)
+    {
+      for(int i = 0; i < 6; i++)
+      {
+        region.Extent[i] = extentArray[i].toInt();
+      }
+    }
+    else
+    {
+      region.UseExtent = false;
+    }
+  }
+
+  VSDataSetFilter* filter = new VSDataSetFilter(filePath, region, parent);
 
   filter->setInitialized(true);
   filter->readTransformJson(json);
+  filter->startLoading();
   return filter;
 }
 
@@ -148,6 +271,23 @@ void VSDataSetFilter::writeJson(QJsonObject& json)
   VSAbstractFilter::writeJson(json);
 
   json["Uuid"] = GetUuid().toString();
+
+  if(m_ReadRegion != ReadRegion())
+  {
+    QJsonObject regionObj;
+    regionObj["Piece"] = m_ReadRegion.Piece;
+    regionObj["NumberOfPieces"] = m_ReadRegion.NumberOfPieces;
+    regionObj["UseExtent"] = m_ReadRegion.UseExtent;
+
+    QJsonArray extentArray;
+    for(int value : m_ReadRegion.Extent)
+    {
+      extentArray.append(value);
+    }
+    regionObj["Extent"] = extentArray;
+
+    json["ReadRegion"] = regionObj;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -156,21 +296,153 @@ void VSDataSetFilter::writeJson(QJsonObject& json)
 void VSDataSetFilter::createFilter()
 {
   m_TrivialProducer = VTK_PTR(vtkTrivialProducer)::New();
+  connect(&m_LoadWatcher, SIGNAL(finished()), this, SLOT(loadingFinished()));
+  connect(this, SIGNAL(loadProgress(int)), this, SLOT(updateLoadingProgress(int)));
 
-  readDataSet();
+  // Sniff the file contents once.  Only the first few kilobytes are read.
+  QMimeDatabase db;
+  m_MimeType = db.mimeTypeForFile(m_FilePath, QMimeDatabase::MatchContent);
+}
 
-  if(m_DataSet != nullptr)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::startLoading()
+{
+  if(m_LoadStarted.exchange(true))
   {
-    updateDisplayName();
+    return;
+  }
 
-    m_DataSet->ComputeBounds();
+  loadDataSet();
+}
 
-    emit updatedOutputPort(this);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::loadDataSet()
+{
+  if(m_LoadWatcher.isRunning())
+  {
+    cancelLoad();
+    m_LoadWatcher.waitForFinished();
   }
-  else
+
+  {
+    QMutexLocker locker(&m_LoadLock);
+    m_CancelLoad = false;
+    m_LoadFuture = QtConcurrent::run(this, &VSDataSetFilter::readDataSet, m_ReadRegion);
+    m_LoadWatcher.setFuture(m_LoadFuture);
+  }
+
+  m_LoadProgress = 0;
+  setText("Loading...");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::loadingFinished()
+{
+  m_LoadProgress = -1;
+
+  if(m_CancelLoad)
+  {
+    // Keep showing any previously loaded data
+    if(nullptr == m_DataSet)
+    {
+      setText("Import Canceled");
+    }
+    else
+    {
+      updateDisplayName();
+    }
+    emit loadFinished(false);
+    return;
+  }
+
+  bool firstLoad = (nullptr == m_DataSet);
+  m_DataSet = nullptr;
+  if(m_LoadWatcher.future().resultCount() > 0)
+  {
+    m_DataSet = m_LoadWatcher.result();
+  }
+
+  if(nullptr == m_DataSet)
   {
     setText("Invalid Import File");
+    emit loadFinished(false);
+    return;
+  }
+
+  m_TrivialProducer->SetOutput(m_DataSet);
+  m_TrivialProducer->Update();
+
+  updateDisplayName();
+  m_DataSet->ComputeBounds();
+
+  emit updatedOutputPort(this);
+  emit arrayNamesChanged();
+  if(firstLoad)
+  {
+    emit dataImported();
+  }
+  emit loadFinished(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::updateLoadingProgress(int percent)
+{
+  // Progress from a canceled or finished load can arrive after loadingFinished()
+  if(m_LoadProgress < 0 || percent <= m_LoadProgress)
+  {
+    return;
+  }
+
+  m_LoadProgress = percent;
+  setText(QString("Loading... %1%").arg(percent));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::watchReader(vtkAlgorithm* reader)
+{
+  VTK_NEW(vtkCallbackCommand, progressCallback);
+  progressCallback->SetCallback(&VSDataSetFilter::ReaderProgressCallback);
+  progressCallback->SetClientData(this);
+  reader->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+
+  QMutexLocker locker(&m_LoadLock);
+  m_ActiveReader = reader;
+  if(m_CancelLoad)
+  {
+    reader->AbortExecuteOn();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::ReaderProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  VSDataSetFilter* filter = static_cast<VSDataSetFilter*>(clientData);
+  vtkAlgorithm* reader = vtkAlgorithm::SafeDownCast(caller);
+  if(nullptr == filter || nullptr == reader)
+  {
+    return;
   }
+
+  if(filter->m_CancelLoad)
+  {
+    reader->AbortExecuteOn();
+    return;
+  }
+
+  int percent = static_cast<int>(reader->GetProgress() * 100.0);
+  emit filter->loadProgress(percent);
 }
 
 // -----------------------------------------------------------------------------
@@ -186,7 +458,13 @@ QString VSDataSetFilter::getText() const
 // -----------------------------------------------------------------------------
 void VSDataSetFilter::setText(QString text)
 {
+  if(m_Text == text)
+  {
+    return;
+  }
+
   m_Text = text;
+  emit filterNameChanged();
 }
 
 // -----------------------------------------------------------------------------
@@ -218,27 +496,34 @@ void VSDataSetFilter::updateDisplayName()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSDataSetFilter::readDataSet()
+VTK_PTR(vtkDataSet) VSDataSetFilter::readDataSet(ReadRegion region)
 {
   QFileInfo fi(m_FilePath);
-  QString ext = fi.completeSuffix().toLower();
-
-  QMimeDatabase db;
-  QMimeType mimeType = db.mimeTypeForFile(m_FilePath, QMimeDatabase::MatchContent);
-  QString mimeName = mimeType.name();
+  QString ext = fi.suffix().toLower();
 
-  if(mimeType.name().startsWith("image/"))
+  VTK_PTR(vtkDataSet) newDataSet = nullptr;
+  if(m_MimeType.name().startsWith("image/"))
   {
-    readImage();
+    newDataSet = readImage();
   }
-  else if(ext == "vtk" || ext == "vti" || ext == "vtp" || ext == "vtr" || ext == "vts" || ext == "vtu")
+  else if(ext == "vtk" || ext == "vti" || ext == "vtp" || ext == "vtr" || ext == "vts" || ext == "vtu" || ext == "pvti" || ext == "pvtp" || ext == "pvtr" ||
+          ext == "pvts" || ext == "pvtu" || ext == "vtm" || ext == "vtmb")
   {
-    readVTKFile();
+    newDataSet = readVTKFile(region);
   }
   else if(ext == "stl")
   {
-    readSTLFile();
+    newDataSet = readSTLFile();
   }
+
+  QMutexLocker locker(&m_LoadLock);
+  m_ActiveReader = nullptr;
+  if(m_CancelLoad)
+  {
+    return nullptr;
+  }
+
+  return newDataSet;
 }
 
 // -----------------------------------------------------------------------------
@@ -246,165 +531,243 @@ void VSDataSetFilter::readDataSet()
 // -----------------------------------------------------------------------------
 void VSDataSetFilter::reloadData()
 {
-  readDataSet();
-
-  if(m_DataSet != nullptr)
-  {
-    updateDisplayName();
-
-    m_DataSet->ComputeBounds();
-
-    emit updatedOutputPort(this);
-  }
-  else
+  // The load watcher and display text belong to the filter's thread
+  if(QThread::currentThread() != thread())
   {
-    setText("Invalid Import File");
+    QMetaObject::invokeMethod(this, "reloadData", Qt::QueuedConnection);
+    return;
   }
+
+  m_LoadStarted = true;
+  loadDataSet();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSDataSetFilter::readImage()
+VTK_PTR(vtkDataSet) VSDataSetFilter::readImage()
 {
-  QMimeDatabase db;
-  QMimeType mimeType = db.mimeTypeForFile(m_FilePath, QMimeDatabase::MatchContent);
-
-  if(mimeType.inherits("image/jpeg"))
+  VTK_PTR(vtkImageReader2) imageReader = nullptr;
+  if(m_MimeType.inherits("image/jpeg"))
   {
-    VTK_NEW(vtkJPEGReader, imageReader);
-    imageReader->SetFileName(m_FilePath.toLatin1().data());
-    imageReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = imageReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    imageReader = VTK_PTR(vtkJPEGReader)::New();
   }
-  else if(mimeType.inherits("image/png"))
+  else if(m_MimeType.inherits("image/png"))
   {
-    VTK_NEW(vtkPNGReader, imageReader);
-    imageReader->SetFileName(m_FilePath.toLatin1().data());
-    imageReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = imageReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    imageReader = VTK_PTR(vtkPNGReader)::New();
   }
-  else if(mimeType.inherits("image/tiff"))
+  else if(m_MimeType.inherits("image/tiff"))
   {
-    VTK_NEW(vtkTIFFReader, imageReader);
-    imageReader->SetFileName(m_FilePath.toLatin1().data());
-    imageReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = imageReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    imageReader = VTK_PTR(vtkTIFFReader)::New();
   }
-  else if(mimeType.inherits("image/bmp"))
+  else if(m_MimeType.inherits("image/bmp"))
   {
-    VTK_NEW(vtkBMPReader, imageReader);
-    imageReader->SetFileName(m_FilePath.toLatin1().data());
-    imageReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = imageReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    imageReader = VTK_PTR(vtkBMPReader)::New();
   }
+  else
+  {
+    return nullptr;
+  }
+
+  watchReader(imageReader);
+  imageReader->SetFileName(m_FilePath.toLatin1().data());
+  imageReader->Update();
+
+  return imageReader->GetOutput();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSDataSetFilter::readVTKFile()
+VTK_PTR(vtkDataSet) VSDataSetFilter::readVTKFile(const ReadRegion& region)
 {
   QFileInfo fi(m_FilePath);
-  QString ext = fi.completeSuffix().toLower();
+  QString ext = fi.suffix().toLower();
 
+  VTK_PTR(vtkDataSet) newDataSet = nullptr;
   if(ext == "vtk")
   {
     VTK_NEW(vtkGenericDataObjectReader, vtkReader);
+    watchReader(vtkReader);
     vtkReader->SetFileName(m_FilePath.toLatin1().data());
     vtkReader->Update();
 
-    VTK_PTR(vtkDataSet) newDataSet = vtkDataSet::SafeDownCast(vtkReader->GetOutput());
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    newDataSet = vtkDataSet::SafeDownCast(vtkReader->GetOutput());
   }
   else if(ext == "vti")
   {
-    VTK_NEW(vtkImageReader2, vtkReader);
-    vtkReader->SetFileName(m_FilePath.toLatin1().data());
-    vtkReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = vtkReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    VTK_NEW(vtkXMLImageDataReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
   }
   else if(ext == "vtp")
   {
-    VTK_NEW(vtkPolyDataReader, vtkReader);
-    vtkReader->SetFileName(m_FilePath.toLatin1().data());
-    vtkReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = vtkReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    VTK_NEW(vtkXMLPolyDataReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
   }
   else if(ext == "vtr")
   {
-    VTK_NEW(vtkRectilinearGridReader, vtkReader);
-    vtkReader->SetFileName(m_FilePath.toLatin1().data());
-    vtkReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = vtkReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    VTK_NEW(vtkXMLRectilinearGridReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
   }
   else if(ext == "vts")
   {
-    VTK_NEW(vtkStructuredGridReader, vtkReader);
-    vtkReader->SetFileName(m_FilePath.toLatin1().data());
-    vtkReader->Update();
-
-    VTK_PTR(vtkDataSet) newDataSet = vtkReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+    VTK_NEW(vtkXMLStructuredGridReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
   }
   else if(ext == "vtu")
   {
-    VTK_NEW(vtkStructuredGridReader, vtkReader);
-    vtkReader->SetFileName(m_FilePath.toLatin1().data());
-    vtkReader->Update();
+    VTK_NEW(vtkXMLUnstructuredGridReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+  else if(ext == "pvti")
+  {
+    VTK_NEW(vtkXMLPImageDataReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+  else if(ext == "pvtp")
+  {
+    VTK_NEW(vtkXMLPPolyDataReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+  else if(ext == "pvtr")
+  {
+    VTK_NEW(vtkXMLPRectilinearGridReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+  else if(ext == "pvts")
+  {
+    VTK_NEW(vtkXMLPStructuredGridReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+  else if(ext == "pvtu")
+  {
+    VTK_NEW(vtkXMLPUnstructuredGridReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+  else if(ext == "vtm" || ext == "vtmb")
+  {
+    VTK_NEW(vtkXMLMultiBlockDataReader, vtkReader);
+    newDataSet = readXMLDataSet(vtkReader, region);
+  }
+
+  return newDataSet;
+}
 
-    VTK_PTR(vtkDataSet) newDataSet = vtkReader->GetOutput();
-    m_TrivialProducer->SetOutput(newDataSet);
-    m_TrivialProducer->Update();
-    m_DataSet = newDataSet;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSDataSetFilter::readXMLDataSet(vtkXMLReader* reader, const ReadRegion& region)
+{
+  QByteArray filePath = m_FilePath.toLocal8Bit();
+  if(!reader->CanReadFile(filePath.data()))
+  {
+    return nullptr;
+  }
+
+  watchReader(reader);
+  reader->SetFileName(filePath.data());
+  reader->UpdateInformation();
+
+  int numPieces = std::max(region.NumberOfPieces, 1);
+  int piece = std::min(std::max(region.Piece, 0), numPieces - 1);
+
+  // Structured readers advertise a whole extent and can be limited to an index extent.
+  // Everything else is read by piece so that appended data outside the piece is skipped.
+  vtkInformation* outInfo = reader->GetOutputInformation(0);
+  if(region.UseExtent && outInfo->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+  {
+    int wholeExtent[6];
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+
+    int extent[6];
+    for(int i = 0; i < 6; i += 2)
+    {
+      extent[i] = std::max(region.Extent[i], wholeExtent[i]);
+      extent[i + 1] = std::min(region.Extent[i + 1], wholeExtent[i + 1]);
+      if(extent[i] > extent[i + 1])
+      {
+        return nullptr;
+      }
+    }
+
+    reader->UpdateExtent(extent);
   }
+  else
+  {
+    reader->UpdatePiece(piece, numPieces, 0);
+  }
+
+  vtkDataObject* output = reader->GetOutputDataObject(0);
+  vtkCompositeDataSet* compositeData = vtkCompositeDataSet::SafeDownCast(output);
+  if(nullptr == compositeData)
+  {
+    return vtkDataSet::SafeDownCast(output);
+  }
+
+  std::vector<vtkDataSet*> leaves;
+  VTK_PTR(vtkCompositeDataIterator) iter;
+  iter.TakeReference(compositeData->NewIterator());
+  for(iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkDataSet* leaf = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+    if(leaf && leaf->GetNumberOfPoints() > 0)
+    {
+      leaves.push_back(leaf);
+    }
+  }
+
+  if(leaves.empty())
+  {
+    return nullptr;
+  }
+  if(leaves.size() == 1)
+  {
+    return leaves.front();
+  }
+
+  VTK_NEW(vtkAppendFilter, appendFilter);
+  for(vtkDataSet* leaf : leaves)
+  {
+    appendFilter->AddInputData(leaf);
+  }
+  appendFilter->Update();
+
+  return appendFilter->GetOutput();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSDataSetFilter::readSTLFile()
+VTK_PTR(vtkDataSet) VSDataSetFilter::readSTLFile()
 {
   VTK_NEW(vtkSTLReader, reader);
+  watchReader(reader);
   reader->SetFileName(m_FilePath.toLatin1().data());
   reader->Update();
 
-  VTK_PTR(vtkDataSet) newDataSet = reader->GetOutput();
-  m_TrivialProducer->SetOutput(newDataSet);
-  m_TrivialProducer->Update();
-  m_DataSet = newDataSet;
+  return reader->GetOutput();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSDataSetFilter::ReadRegion VSDataSetFilter::getReadRegion() const
+{
+  return m_ReadRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSDataSetFilter::setReadRegion(const ReadRegion& region)
+{
+  if(m_ReadRegion == region)
+  {
+    return;
+  }
+
+  m_ReadRegion = region;
+  reloadData();
 }
 
 // -----------------------------------------------------------------------------
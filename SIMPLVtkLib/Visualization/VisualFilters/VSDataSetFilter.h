@@ -35,6 +35,13 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+
+#include <QtCore/QFuture>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QMimeType>
+#include <QtCore/QMutex>
 #include <QtWidgets/QWidget>
 
 #include <vtkDataSet.h>
@@ -46,18 +53,38 @@
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
+class vtkXMLReader;
+
 /**
  * @class VSDataSetFilter VSDataSetFilter.h
  * SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h
  * @brief This class stores a WrappedDataContainerPtr and provides an output port
  * for other filters to connect to for converting SIMPLib DataContainers to something
- * VTK can render.
+ * VTK can render.  Files are read on a worker thread and the output is swapped in
+ * once the reader finishes.
  */
 class SIMPLVtkLib_EXPORT VSDataSetFilter : public VSAbstractDataFilter
 {
   Q_OBJECT
 
 public:
+  /**
+   * @brief Describes which part of a VTK XML file should be read.  Pieces are
+   * used for unstructured, poly, and multiblock files.  Structured files
+   * (.vti, .vts, .vtr, .pvti) can instead be limited to an index extent.  The
+   * default region reads the entire file.
+   */
+  struct ReadRegion
+  {
+    int Piece = 0;
+    int NumberOfPieces = 1;
+    bool UseExtent = false;
+    std::array<int, 6> Extent = {{0, -1, 0, -1, 0, -1}};
+
+    bool operator==(const ReadRegion& other) const;
+    bool operator!=(const ReadRegion& other) const;
+  };
+
   /**
    * @brief Constructor
    * @param filePath
@@ -66,9 +93,18 @@ public:
   VSDataSetFilter(const QString& filePath, VSAbstractFilter* parent = nullptr);
 
   /**
-   * @brief Deconstructor
+   * @brief Constructor that only reads the given region of a VTK XML file.
+   * The region is ignored for file types that cannot be streamed.
+   * @param filePath
+   * @param region
+   * @param parent
    */
-  virtual ~VSDataSetFilter() = default;
+  VSDataSetFilter(const QString& filePath, const ReadRegion& region, VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Deconstructor.  Cancels and waits for any file read in progress.
+   */
+  virtual ~VSDataSetFilter();
 
   /**
    * @brief Creates a new VSDataSetFilter from the given arguments
@@ -84,6 +120,25 @@ public:
    */
   bool isFlatImage() override;
 
+  /**
+   * @brief Returns true while the file is being read.  Returns false otherwise.
+   * @return
+   */
+  bool isLoading() const;
+
+  /**
+   * @brief Requests that the file read in progress be aborted.  Any previously
+   * loaded data is kept.
+   */
+  void cancelLoad();
+
+  /**
+   * @brief Blocks until the current file read finishes.  Returns true if a data
+   * set was read.  Returns false if the read failed or was canceled.
+   * @return
+   */
+  bool waitForLoad();
+
   /**
    * @brief Returns the bounds of the vtkDataSet
    * @return
@@ -133,6 +188,19 @@ public:
    */
   void reloadData() override;
 
+  /**
+   * @brief Returns the region of the file that is read
+   * @return
+   */
+  ReadRegion getReadRegion() const;
+
+  /**
+   * @brief Sets the region of the file to read and reloads the data if the
+   * region changed.
+   * @param region
+   */
+  void setReadRegion(const ReadRegion& region);
+
   /**
    * @brief Returns the filter values associated with the filter
    * @return
@@ -152,6 +220,32 @@ public:
    */
   QString getInfoString(SIMPL::InfoStringFormat format) const override;
 
+public slots:
+  /**
+   * @brief Starts reading the current read region on a worker thread unless a read
+   * was already started.  Loading is not started when the filter is created so that
+   * importers control when the file is read.  Filters created without an importer
+   * start loading the first time getOutput() is called.  Must be called on the
+   * filter's thread.
+   */
+  void startLoading();
+
+signals:
+  void loadProgress(int percent);
+  void loadFinished(bool success);
+
+protected slots:
+  /**
+   * @brief Swaps in the data set read on the worker thread
+   */
+  void loadingFinished();
+
+  /**
+   * @brief Updates the display text with the reader's progress
+   * @param percent
+   */
+  void updateLoadingProgress(int percent);
+
 protected:
   /**
    * @brief Initializes the trivial producer and connects it to the vtkMapper
@@ -162,25 +256,43 @@ protected:
    * @brief Returns the text to display for the filter's display role
    * @return
    */
-  QString getText() const;
+  QString getText() const override;
 
   /**
    * @brief Sets the text to display for the filter's display role
    * @param text
    */
-  void setText(QString text);
+  void setText(QString text) override;
 
 private:
   QString m_FilePath;
+  ReadRegion m_ReadRegion;
   VTK_PTR(vtkDataSet) m_DataSet = nullptr;
   VTK_PTR(vtkTrivialProducer) m_TrivialProducer = nullptr;
   VSDataSetValues* m_DataSetValues = nullptr;
   QString m_Text;
+  QMimeType m_MimeType;
+
+  QFutureWatcher<VTK_PTR(vtkDataSet)> m_LoadWatcher;
+  QFuture<VTK_PTR(vtkDataSet)> m_LoadFuture;
+  QMutex m_LoadLock;
+  VTK_PTR(vtkAlgorithm) m_ActiveReader = nullptr;
+  std::atomic_bool m_CancelLoad;
+  mutable std::atomic_bool m_LoadStarted;
+  int m_LoadProgress = -1;
+
+  /**
+   * @brief Reads the current read region on a worker thread.  A read that is already
+   * running is canceled first.
+   */
+  void loadDataSet();
 
   /**
-   * @brief readDataSet
+   * @brief Reads the given region of the file.  Called from a worker thread.
+   * @param region
+   * @return
    */
-  void readDataSet();
+  VTK_PTR(vtkDataSet) readDataSet(ReadRegion region);
 
   /**
    * @brief updateDisplayName
@@ -189,16 +301,46 @@ private:
 
   /**
    * @brief readImage
+   * @return
    */
-  void readImage();
+  VTK_PTR(vtkDataSet) readImage();
 
   /**
    * @brief readVTKFile
+   * @param region
+   * @return
+   */
+  VTK_PTR(vtkDataSet) readVTKFile(const ReadRegion& region);
+
+  /**
+   * @brief Reads the current read region using the given XML reader.  Only the
+   * requested piece or extent is loaded from appended data.  Multiblock leaves
+   * are appended into a single dataset when more than one is read.
+   * @param reader
+   * @param region
+   * @return
    */
-  void readVTKFile();
+  VTK_PTR(vtkDataSet) readXMLDataSet(vtkXMLReader* reader, const ReadRegion& region);
+
+  /**
+   * @brief Forwards the reader's progress events and registers it as the reader
+   * to abort when the load is canceled.
+   * @param reader
+   */
+  void watchReader(vtkAlgorithm* reader);
+
+  /**
+   * @brief vtkCommand::ProgressEvent callback for the active reader
+   * @param caller
+   * @param eventId
+   * @param clientData
+   * @param callData
+   */
+  static void ReaderProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData);
 
   /**
    * @brief readSTLFile
+   * @return
    */
-  void readSTLFile();
+  VTK_PTR(vtkDataSet) readSTLFile();
 };
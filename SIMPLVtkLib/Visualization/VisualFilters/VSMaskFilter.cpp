@@ -40,6 +40,7 @@
 
 #include <vtkCellData.h>
 #include <vtkImageData.h>
+#include <vtkInformation.h>
 #include <vtkUnstructuredGrid.h>
 
 // -----------------------------------------------------------------------------
@@ -87,7 +88,11 @@ VSMaskFilter* VSMaskFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
 void VSMaskFilter::createFilter()
 {
   m_MaskAlgorithm = VTK_PTR(vtkThreshold)::New();
-  m_MaskAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+
+  // createApplyAlgorithm gives each apply a copy with its own partition algorithm factory
+  m_ParallelAlgorithm = VTK_PTR(VSParallelAlgorithm)::New();
+  m_ParallelAlgorithm->SetOutputType(VTK_UNSTRUCTURED_GRID);
+  m_ParallelAlgorithm->SetAlgorithm(m_MaskAlgorithm);
   setConnectedInput(true);
 }
 
@@ -141,9 +146,7 @@ void VSMaskFilter::apply(QString name)
 
   m_MaskAlgorithm->ThresholdByUpper(1.0);
   m_MaskAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(name));
-  m_MaskAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  startApply();
 }
 
 // -----------------------------------------------------------------------------
@@ -170,9 +173,9 @@ void VSMaskFilter::writeJson(QJsonObject& json)
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSMaskFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_MaskAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_MaskAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -187,9 +190,9 @@ vtkAlgorithmOutput* VSMaskFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSMaskFilter::getOutput() const
 {
-  if(getConnectedInput() && m_MaskAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_MaskAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -213,7 +216,8 @@ void VSMaskFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_MaskAlgorithm)
   {
-    m_MaskAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Recompute the output from the parent filter's new output
+    startApply();
   }
   else
   {
@@ -221,6 +225,34 @@ void VSMaskFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) VSMaskFilter::createApplyAlgorithm()
+{
+  if(nullptr == m_ParallelAlgorithm)
+  {
+    return nullptr;
+  }
+
+  // Copy the parameters on the calling thread so that the worker never reads m_MaskAlgorithm
+  double lower = m_MaskAlgorithm->GetLowerThreshold();
+  VTK_NEW(vtkInformation, arrayInfo);
+  arrayInfo->Copy(m_MaskAlgorithm->GetInputArrayInformation(0), 1);
+
+  auto factory = [lower, arrayInfo]() -> VTK_PTR(vtkAlgorithm) {
+    VTK_NEW(vtkThreshold, partitionMask);
+    partitionMask->ThresholdByUpper(lower);
+    partitionMask->SetInputArrayToProcess(0, arrayInfo);
+    return partitionMask;
+  };
+
+  VTK_PTR(VSParallelAlgorithm) algorithm = m_ParallelAlgorithm->CreateCopy();
+  algorithm->SetAlgorithm(factory());
+  algorithm->SetAlgorithmFactory(factory);
+  return algorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
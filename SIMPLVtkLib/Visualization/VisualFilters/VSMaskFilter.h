@@ -40,6 +40,7 @@
 #include <vtkThreshold.h>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSParallelAlgorithm.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskValues.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -194,8 +195,15 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns a copy of the configured algorithm to run on a worker thread
+   * @return
+   */
+  VTK_PTR(vtkAlgorithm) createApplyAlgorithm() override;
+
 private:
   VTK_PTR(vtkThreshold) m_MaskAlgorithm;
+  VTK_PTR(VSParallelAlgorithm) m_ParallelAlgorithm;
   VSMaskValues* m_MaskValues = nullptr;
 };
 
@@ -0,0 +1,541 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSParallelAlgorithm.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include <vtkAppendFilter.h>
+#include <vtkAppendPolyData.h>
+#include <vtkCallbackCommand.h>
+#include <vtkCellData.h>
+#include <vtkCleanPolyData.h>
+#include <vtkCommand.h>
+#include <vtkDataArray.h>
+#include <vtkDataObjectTypes.h>
+#include <vtkExtractCells.h>
+#include <vtkFieldData.h>
+#include <vtkGenericCell.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkUnstructuredGrid.h>
+
+vtkStandardNewMacro(VSParallelAlgorithm);
+
+namespace
+{
+int s_NumberOfThreads = 0;
+vtkIdType s_MinimumCellsPerPartition = 65536;
+
+/**
+ * @brief Returns true if every array can be referenced by offset without copying it
+ */
+bool CanShareArrays(vtkDataSetAttributes* attributes)
+{
+  for(int i = 0; i < attributes->GetNumberOfArrays(); i++)
+  {
+    vtkAbstractArray* array = attributes->GetAbstractArray(i);
+    if(nullptr == vtkDataArray::SafeDownCast(array) || false == array->HasStandardMemoryLayout())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Adds arrays to the target referencing numTuples tuples of the source arrays
+ * starting at tupleOffset.  Active attributes are kept.
+ */
+void ShareArrays(vtkDataSetAttributes* source, vtkDataSetAttributes* target, vtkIdType tupleOffset, vtkIdType numTuples)
+{
+  for(int i = 0; i < source->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = source->GetArray(i);
+    int numComps = array->GetNumberOfComponents();
+
+    VTK_PTR(vtkDataArray) view = VTK_PTR(vtkDataArray)::Take(array->NewInstance());
+    view->SetName(array->GetName());
+    view->SetNumberOfComponents(numComps);
+    view->SetVoidArray(array->GetVoidPointer(tupleOffset * numComps), numTuples * numComps, 1);
+    target->AddArray(view);
+  }
+
+  for(int attributeType = 0; attributeType < vtkDataSetAttributes::NUM_ATTRIBUTES; attributeType++)
+  {
+    vtkDataArray* attribute = source->GetAttribute(attributeType);
+    if(attribute && attribute->GetName())
+    {
+      target->SetActiveAttribute(attribute->GetName(), attributeType);
+    }
+  }
+}
+
+/**
+ * @brief Splits the image into slabs along its slowest varying axis.  Each slab references
+ * the image's arrays instead of copying them.  Returns an empty vector if the image
+ * cannot be split.
+ */
+std::vector<VTK_PTR(vtkDataSet)> PartitionImage(vtkImageData* image, int count)
+{
+  std::vector<VTK_PTR(vtkDataSet)> partitions;
+  if(false == (CanShareArrays(image->GetPointData()) && CanShareArrays(image->GetCellData())))
+  {
+    return partitions;
+  }
+
+  int extent[6];
+  image->GetExtent(extent);
+
+  int axis = 2;
+  while(axis >= 0 && extent[2 * axis + 1] <= extent[2 * axis])
+  {
+    axis--;
+  }
+  if(axis < 0)
+  {
+    return partitions;
+  }
+
+  vtkIdType cellsPerLayer = 1;
+  vtkIdType pointsPerLayer = 1;
+  for(int i = 0; i < 3; i++)
+  {
+    if(i != axis)
+    {
+      cellsPerLayer *= std::max(extent[2 * i + 1] - extent[2 * i], 1);
+      pointsPerLayer *= extent[2 * i + 1] - extent[2 * i] + 1;
+    }
+  }
+
+  const int layerCount = extent[2 * axis + 1] - extent[2 * axis];
+  count = std::min(count, layerCount);
+  for(int i = 0; i < count; i++)
+  {
+    int layerBegin = extent[2 * axis] + static_cast<int>(static_cast<long long>(layerCount) * i / count);
+    int layerEnd = extent[2 * axis] + static_cast<int>(static_cast<long long>(layerCount) * (i + 1) / count);
+    vtkIdType layerOffset = layerBegin - extent[2 * axis];
+
+    int slabExtent[6];
+    std::copy(extent, extent + 6, slabExtent);
+    slabExtent[2 * axis] = layerBegin;
+    slabExtent[2 * axis + 1] = layerEnd;
+
+    VTK_NEW(vtkImageData, slab);
+    slab->SetOrigin(image->GetOrigin());
+    slab->SetSpacing(image->GetSpacing());
+#if VTK_MAJOR_VERSION >= 9
+    slab->SetDirectionMatrix(image->GetDirectionMatrix());
+#endif
+    slab->SetExtent(slabExtent);
+    slab->GetFieldData()->ShallowCopy(image->GetFieldData());
+
+    ShareArrays(image->GetPointData(), slab->GetPointData(), layerOffset * pointsPerLayer, (layerEnd - layerBegin + 1) * pointsPerLayer);
+    ShareArrays(image->GetCellData(), slab->GetCellData(), layerOffset * cellsPerLayer, (layerEnd - layerBegin) * cellsPerLayer);
+
+    partitions.push_back(slab);
+  }
+
+  return partitions;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSParallelAlgorithm::VSParallelAlgorithm()
+: vtkDataSetAlgorithm()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSParallelAlgorithm::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "OutputType: " << vtkDataObjectTypes::GetClassNameFromTypeId(OutputType) << endl;
+  os << indent << "NumberOfThreads: " << GetNumberOfThreads() << endl;
+  os << indent << "NumberOfPartitions: " << NumberOfPartitions << endl;
+  os << indent << "Algorithm: " << (m_Algorithm ? m_Algorithm->GetClassName() : "(none)") << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSParallelAlgorithm::SetNumberOfThreads(int numThreads)
+{
+  ::s_NumberOfThreads = std::max(numThreads, 0);
+  vtkSMPTools::Initialize(::s_NumberOfThreads);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSParallelAlgorithm::GetNumberOfThreads()
+{
+  if(::s_NumberOfThreads > 0)
+  {
+    return ::s_NumberOfThreads;
+  }
+
+  return vtkSMPTools::GetEstimatedNumberOfThreads();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSParallelAlgorithm::SetMinimumCellsPerPartition(vtkIdType numCells)
+{
+  ::s_MinimumCellsPerPartition = std::max<vtkIdType>(numCells, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSParallelAlgorithm::GetMinimumCellsPerPartition()
+{
+  return ::s_MinimumCellsPerPartition;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSParallelAlgorithm::SetAlgorithm(vtkAlgorithm* algorithm)
+{
+  if(m_Algorithm == algorithm)
+  {
+    return;
+  }
+
+  m_Algorithm = algorithm;
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithm* VSParallelAlgorithm::GetAlgorithm() const
+{
+  return m_Algorithm;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSParallelAlgorithm::SetAlgorithmFactory(AlgorithmFactory factory)
+{
+  m_AlgorithmFactory = factory;
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkMTimeType VSParallelAlgorithm::GetMTime()
+{
+  vtkMTimeType mTime = Superclass::GetMTime();
+  if(m_Algorithm)
+  {
+    mTime = std::max(mTime, m_Algorithm->GetMTime());
+  }
+
+  return mTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSParallelAlgorithm::RequestDataObject(vtkInformation* vtkNotUsed(request), vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  if(output && output->GetDataObjectType() == OutputType)
+  {
+    return 1;
+  }
+
+  VTK_PTR(vtkDataObject) newOutput = VTK_PTR(vtkDataObject)::Take(vtkDataObjectTypes::NewDataObject(OutputType));
+  if(nullptr == newOutput)
+  {
+    vtkErrorMacro("Could not create an output of type " << OutputType);
+    return 0;
+  }
+
+  outInfo->Set(vtkDataObject::DATA_OBJECT(), newOutput);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSParallelAlgorithm::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkDataSet* input = vtkDataSet::GetData(inputVector[0]);
+  vtkDataSet* output = vtkDataSet::GetData(outputVector);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  if(!m_AlgorithmFactory)
+  {
+    vtkErrorMacro("No AlgorithmFactory set");
+    return 0;
+  }
+
+  int count = getPartitionCount(input);
+  if(count <= 1)
+  {
+    NumberOfPartitions = 1;
+    return executeSerial(input, output) ? 1 : 0;
+  }
+
+  // Each partition is processed by its own pipeline so that no vtkAlgorithm is shared between threads
+  std::vector<VTK_PTR(vtkAlgorithm)> algorithms;
+  vtkImageData* image = vtkImageData::SafeDownCast(input);
+  std::vector<VTK_PTR(vtkDataSet)> slabs = image ? ::PartitionImage(image, count) : std::vector<VTK_PTR(vtkDataSet)>();
+  if(slabs.size() > 1)
+  {
+    for(const VTK_PTR(vtkDataSet)& slab : slabs)
+    {
+      VTK_PTR(vtkAlgorithm) algorithm = m_AlgorithmFactory();
+      algorithm->SetInputDataObject(slab);
+      algorithms.push_back(algorithm);
+    }
+  }
+  else
+  {
+    // The first GetCell call builds any structures the input creates on demand so
+    // that the cell ranges can be extracted concurrently.
+    VTK_NEW(vtkGenericCell, cell);
+    input->GetCell(0, cell);
+
+    VTK_PTR(vtkDataSet) inputCopy = VTK_PTR(vtkDataSet)::Take(input->NewInstance());
+    inputCopy->ShallowCopy(input);
+
+    vtkIdType numCells = input->GetNumberOfCells();
+    for(int i = 0; i < count; i++)
+    {
+      VTK_NEW(vtkExtractCells, extractCells);
+      extractCells->SetInputData(inputCopy);
+      extractCells->AddCellRange(numCells * i / count, numCells * (i + 1) / count - 1);
+
+      VTK_PTR(vtkAlgorithm) algorithm = m_AlgorithmFactory();
+      algorithm->SetInputConnection(extractCells->GetOutputPort());
+      algorithms.push_back(algorithm);
+    }
+  }
+
+  NumberOfPartitions = static_cast<int>(algorithms.size());
+  return executePartitions(algorithms, output) ? 1 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSParallelAlgorithm::getPartitionCount(vtkDataSet* input) const
+{
+  int numThreads = GetNumberOfThreads();
+  vtkIdType numCells = input->GetNumberOfCells();
+  if(numThreads <= 1 || numCells < 2 * ::s_MinimumCellsPerPartition)
+  {
+    return 1;
+  }
+
+  return static_cast<int>(std::min<vtkIdType>(numThreads, numCells / ::s_MinimumCellsPerPartition));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSParallelAlgorithm::executeSerial(vtkDataSet* input, vtkDataSet* output)
+{
+  VTK_PTR(vtkDataSet) inputCopy = VTK_PTR(vtkDataSet)::Take(input->NewInstance());
+  inputCopy->ShallowCopy(input);
+
+  VTK_PTR(vtkAlgorithm) algorithm = m_AlgorithmFactory();
+  algorithm->SetInputDataObject(inputCopy);
+
+  VTK_NEW(vtkCallbackCommand, progressCallback);
+  progressCallback->SetCallback(&VSParallelAlgorithm::ForwardProgressCallback);
+  progressCallback->SetClientData(this);
+  algorithm->AddObserver(vtkCommand::ProgressEvent, progressCallback);
+
+  algorithm->Update();
+
+  vtkDataSet* result = vtkDataSet::SafeDownCast(algorithm->GetOutputDataObject(0));
+  if(nullptr == result || result->GetDataObjectType() != output->GetDataObjectType())
+  {
+    vtkErrorMacro("Algorithm output does not match the OutputType");
+    return false;
+  }
+
+  output->ShallowCopy(result);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSParallelAlgorithm::executePartitions(const std::vector<VTK_PTR(vtkAlgorithm)>& algorithms, vtkDataSet* output)
+{
+  // Progress is reported as partitions finish.  Partitions not yet started are skipped once aborted.
+  std::mutex progressLock;
+  int finishedCount = 0;
+  const double partitionCount = static_cast<double>(algorithms.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(algorithms.size()), 1, [&](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      if(GetAbortExecute())
+      {
+        return;
+      }
+
+      algorithms[i]->Update();
+
+      std::lock_guard<std::mutex> lock(progressLock);
+      finishedCount++;
+      UpdateProgress(finishedCount / partitionCount);
+    }
+  });
+
+  if(GetAbortExecute())
+  {
+    output->Initialize();
+    return true;
+  }
+
+  // Partitions without cells may not have any arrays and would remove them from the appended output
+  std::vector<vtkDataSet*> results;
+  for(const VTK_PTR(vtkAlgorithm)& algorithm : algorithms)
+  {
+    vtkDataSet* result = vtkDataSet::SafeDownCast(algorithm->GetOutputDataObject(0));
+    if(nullptr == result || result->GetDataObjectType() != output->GetDataObjectType())
+    {
+      vtkErrorMacro("Algorithm output does not match the OutputType");
+      return false;
+    }
+    if(result->GetNumberOfCells() > 0)
+    {
+      results.push_back(result);
+    }
+  }
+
+  if(results.empty())
+  {
+    output->Initialize();
+    return true;
+  }
+  if(results.size() == 1)
+  {
+    output->ShallowCopy(results.front());
+    return true;
+  }
+
+  if(VTK_POLY_DATA == OutputType)
+  {
+    VTK_NEW(vtkAppendPolyData, append);
+    for(vtkDataSet* result : results)
+    {
+      append->AddInputData(vtkPolyData::SafeDownCast(result));
+    }
+
+    // Neighboring partitions share their seam points.  Only exact duplicates are merged.
+    VTK_NEW(vtkCleanPolyData, clean);
+    clean->SetInputConnection(append->GetOutputPort());
+    clean->ToleranceIsAbsoluteOn();
+    clean->SetAbsoluteTolerance(0.0);
+    clean->ConvertLinesToPointsOff();
+    clean->ConvertPolysToLinesOff();
+    clean->ConvertStripsToPolysOff();
+    clean->Update();
+    output->ShallowCopy(clean->GetOutput());
+  }
+  else
+  {
+    VTK_NEW(vtkAppendFilter, append);
+    for(vtkDataSet* result : results)
+    {
+      append->AddInputData(result);
+    }
+
+    // Neighboring partitions share their seam points
+    append->MergePointsOn();
+    append->Update();
+    output->ShallowCopy(append->GetOutput());
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSParallelAlgorithm::ForwardProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  VSParallelAlgorithm* self = static_cast<VSParallelAlgorithm*>(clientData);
+  vtkAlgorithm* algorithm = vtkAlgorithm::SafeDownCast(caller);
+  if(nullptr == self || nullptr == algorithm)
+  {
+    return;
+  }
+
+  self->UpdateProgress(algorithm->GetProgress());
+  if(self->GetAbortExecute())
+  {
+    algorithm->AbortExecuteOn();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(VSParallelAlgorithm) VSParallelAlgorithm::CreateCopy() const
+{
+  VTK_NEW(VSParallelAlgorithm, copy);
+  copy->m_Algorithm = m_Algorithm;
+  copy->m_AlgorithmFactory = m_AlgorithmFactory;
+  copy->OutputType = OutputType;
+  return copy;
+}
@@ -0,0 +1,186 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <vtkDataSetAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSParallelAlgorithm VSParallelAlgorithm.h SIMPLVtkLib/Visualization/VisualFilters/VSParallelAlgorithm.h
+ * @brief This class runs a serial vtkAlgorithm over partitions of its input using
+ * vtkSMPTools and appends the partial results into a single output.  vtkImageData
+ * inputs are split into slabs along their slowest axis that reference the input
+ * arrays without copying them.  Other inputs are split into ranges of cell IDs.
+ * Each partition is processed by its own algorithm created by the AlgorithmFactory.
+ * Inputs that are too small to benefit, or that cannot be partitioned, are processed
+ * by a single algorithm on the calling thread.  Points duplicated along partition seams
+ * are merged when the results are appended.
+ */
+class SIMPLVtkLib_EXPORT VSParallelAlgorithm : public vtkDataSetAlgorithm
+{
+public:
+  using AlgorithmFactory = std::function<VTK_PTR(vtkAlgorithm)()>;
+
+  static VSParallelAlgorithm* New();
+  vtkTypeMacro(VSParallelAlgorithm, vtkDataSetAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets the number of threads used by parallel algorithms.  A value of 0 uses
+   * the number of threads chosen by vtkSMPTools.  A value of 1 disables partitioning.
+   * @param numThreads
+   */
+  static void SetNumberOfThreads(int numThreads);
+
+  /**
+   * @brief Returns the number of threads used by parallel algorithms
+   * @return
+   */
+  static int GetNumberOfThreads();
+
+  /**
+   * @brief Sets the minimum number of input cells each partition should contain
+   * @param numCells
+   */
+  static void SetMinimumCellsPerPartition(vtkIdType numCells);
+
+  /**
+   * @brief Returns the minimum number of input cells each partition should contain
+   * @return
+   */
+  static vtkIdType GetMinimumCellsPerPartition();
+
+  /**
+   * @brief Sets the vtkAlgorithm that defines the operation.  Its parameters are only
+   * read by the AlgorithmFactory and its modified time is included in this algorithm's.
+   * The algorithm should not be connected to a pipeline.
+   * @param algorithm
+   */
+  void SetAlgorithm(vtkAlgorithm* algorithm);
+
+  /**
+   * @brief Returns the vtkAlgorithm that defines the operation
+   * @return
+   */
+  vtkAlgorithm* GetAlgorithm() const;
+
+  /**
+   * @brief Sets the function used to create a configured copy of the algorithm for
+   * each partition.  The function is always called on the thread updating the pipeline.
+   * @param factory
+   */
+  void SetAlgorithmFactory(AlgorithmFactory factory);
+
+  /**
+   * @brief Sets the output data type.  Only VTK_POLY_DATA and VTK_UNSTRUCTURED_GRID are supported.
+   */
+  vtkSetMacro(OutputType, int)
+  vtkGetMacro(OutputType, int)
+
+  /**
+   * @brief Returns the number of partitions used during the last execution
+   */
+  vtkGetMacro(NumberOfPartitions, int)
+
+  /**
+   * @brief Returns a new VSParallelAlgorithm with the same algorithm, factory, and output
+   * type but without any input connection
+   * @return
+   */
+  VTK_PTR(VSParallelAlgorithm) CreateCopy() const;
+
+  /**
+   * @brief Returns the modified time including that of the algorithm
+   * @return
+   */
+  vtkMTimeType GetMTime() override;
+
+protected:
+  VSParallelAlgorithm();
+  ~VSParallelAlgorithm() override = default;
+
+  int RequestDataObject(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Runs a single algorithm over the entire input
+   * @param input
+   * @param output
+   * @return
+   */
+  bool executeSerial(vtkDataSet* input, vtkDataSet* output);
+
+  /**
+   * @brief Updates each partition's algorithm concurrently and appends the results into the output
+   * @param algorithms
+   * @param output
+   * @return
+   */
+  bool executePartitions(const std::vector<VTK_PTR(vtkAlgorithm)>& algorithms, vtkDataSet* output);
+
+  /**
+   * @brief Returns the number of partitions to use for the given input
+   * @param input
+   * @return
+   */
+  int getPartitionCount(vtkDataSet* input) const;
+
+  /**
+   * @brief vtkCommand::ProgressEvent callback that forwards progress from the serial
+   * algorithm and passes on any abort request
+   * @param caller
+   * @param eventId
+   * @param clientData
+   * @param callData
+   */
+  static void ForwardProgressCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData);
+
+private:
+  VTK_PTR(vtkAlgorithm) m_Algorithm = nullptr;
+  AlgorithmFactory m_AlgorithmFactory;
+  int OutputType = VTK_UNSTRUCTURED_GRID;
+  int NumberOfPartitions = 0;
+
+  VSParallelAlgorithm(const VSParallelAlgorithm&) = delete;
+  void operator=(const VSParallelAlgorithm&) = delete;
+};
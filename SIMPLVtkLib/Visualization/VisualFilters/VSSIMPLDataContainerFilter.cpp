@@ -36,6 +36,8 @@
 #include "VSSIMPLDataContainerFilter.h"
 
 #include <QtConcurrent>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QUuid>
 
 #include <vtkAlgorithmOutput.h>
@@ -44,6 +46,7 @@
 #include <vtkDataSet.h>
 #include <vtkExtractVOI.h>
 #include <vtkImageData.h>
+#include <vtkPointData.h>
 #include <vtkPointSet.h>
 #include <vtkTransformFilter.h>
 
@@ -59,6 +62,39 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSPipelineFilter.h"
 
+namespace
+{
+// Streamed tiles may come back into view together.  Reading is serialized
+// since the HDF5 library is not guaranteed to be built thread safe.
+QMutex s_StreamReadLock;
+
+/**
+ * @brief Wraps the geometry of the given DataContainer without any of its arrays.  The
+ * array selection is kept so that it can be reapplied when the arrays are read again.
+ * @param wrappedDc
+ * @return
+ */
+SIMPLVtkBridge::WrappedDataContainerPtr CreatePlaceholder(const SIMPLVtkBridge::WrappedDataContainerPtr& wrappedDc)
+{
+  // Keep the geometry so that bounds and transforms remain valid while evicted
+  DataContainer::Pointer placeholderDc = DataContainer::New(wrappedDc->m_Name);
+  placeholderDc->setGeometry(wrappedDc->m_DataContainer->getGeometry());
+  SIMPLVtkBridge::WrappedDataContainerPtr placeholder = SIMPLVtkBridge::WrapGeometryPtr(placeholderDc);
+  if(nullptr == placeholder)
+  {
+    return nullptr;
+  }
+
+  for(int i = 0; i < 3; i++)
+  {
+    placeholder->m_Origin[i] = wrappedDc->m_Origin[i];
+  }
+  placeholder->m_ImportCellArrays = wrappedDc->m_ImportCellArrays;
+  placeholder->m_ImportPointArrays = wrappedDc->m_ImportPointArrays;
+  return placeholder;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -83,6 +119,7 @@ VSSIMPLDataContainerFilter::~VSSIMPLDataContainerFilter()
 {
   if(m_DCValues->getWrappedDataContainer())
   {
+    SIMPLVtkBridge::ReleaseArrayStatistics(m_DCValues->getWrappedDataContainer());
     size_t count = m_DCValues->getWrappedDataContainer()->m_CellData.size();
     for(size_t i = 0; i < count; i++)
     {
@@ -90,6 +127,7 @@ VSSIMPLDataContainerFilter::~VSSIMPLDataContainerFilter()
       m_DCValues->getWrappedDataContainer()->m_CellData[i]->m_VtkArray = nullptr;
     }
     m_DCValues->getWrappedDataContainer()->m_CellData.clear();
+    m_DCValues->getWrappedDataContainer()->m_DerivedPointData.clear();
     m_DCValues->getWrappedDataContainer() = nullptr;
   }
 
@@ -101,19 +139,26 @@ VSSIMPLDataContainerFilter::~VSSIMPLDataContainerFilter()
 // -----------------------------------------------------------------------------
 bool VSSIMPLDataContainerFilter::isFlatImage()
 {
-  // Check dimensions
   SIMPLVtkBridge::WrappedDataContainerPtr wrappedDC = m_DCValues->getWrappedDataContainer();
   if(nullptr == wrappedDC)
   {
     return false;
   }
 
-  DataContainer::Pointer dc = wrappedDC->m_DataContainer;
+  return IsFlatImage(wrappedDC->m_DataContainer);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::IsFlatImage(const DataContainer::Pointer& dc)
+{
   if(nullptr == dc)
   {
     return false;
   }
 
+  // Check dimensions
   ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
   if(nullptr == imageGeom)
   {
@@ -394,6 +439,8 @@ void VSSIMPLDataContainerFilter::reloadData()
 // -----------------------------------------------------------------------------
 void VSSIMPLDataContainerFilter::reloadData(DataContainer::Pointer dc)
 {
+  // Ranges of the previous arrays no longer apply
+  SIMPLVtkBridge::ReleaseArrayStatistics(m_DCValues->getWrappedDataContainer());
   m_DCValues->setWrappedDataContainer(SIMPLVtkBridge::WrapDataContainerAsStruct(dc));
 }
 
@@ -419,7 +466,23 @@ void VSSIMPLDataContainerFilter::reloadWrappingFinished()
   m_TrivialProducer->SetOutput(dataSet);
 
   emit updatedOutputPort(this);
-  emit dataReloaded();
+  if(m_RestoringData)
+  {
+    // A failed read leaves the geometry-only placeholder in place
+    m_RestoringData = false;
+    if(dataFullyLoaded())
+    {
+      emit dataRestored();
+    }
+    else
+    {
+      emit dataEvicted();
+    }
+  }
+  else
+  {
+    emit dataReloaded();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -482,6 +545,238 @@ bool VSSIMPLDataContainerFilter::dataFullyLoaded()
   return m_DCValues->isFullyWrapped();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::canStreamData()
+{
+  if(nullptr == dynamic_cast<VSFileNameFilter*>(getParentFilter()))
+  {
+    return false;
+  }
+
+  return isFlatImage();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::isDataResident() const
+{
+  return m_DataResident;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::evictData()
+{
+  if(!m_DataResident || m_WrappingWatcher.isRunning() || !dataFullyLoaded() || !canStreamData())
+  {
+    return;
+  }
+
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = m_DCValues->getWrappedDataContainer();
+  SIMPLVtkBridge::WrappedDataContainerPtr placeholder = ::CreatePlaceholder(wrappedDc);
+  if(nullptr == placeholder)
+  {
+    return;
+  }
+
+  SIMPLVtkBridge::ReleasePointDataArrays(wrappedDc);
+  m_DCValues->setWrappedDataContainer(placeholder);
+  m_TrivialProducer->SetOutput(placeholder->m_DataSet);
+  m_DataResident = false;
+
+  emit dataEvicted();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::importEvicted()
+{
+  SIMPLVtkBridge::WrappedDataContainerPtr placeholder = ::CreatePlaceholder(m_DCValues->getWrappedDataContainer());
+  if(nullptr == placeholder)
+  {
+    return;
+  }
+
+  // The imported DataContainer only describes the arrays without holding their values
+  m_DCValues->setWrappedDataContainer(placeholder);
+  m_TrivialProducer->SetOutput(placeholder->m_DataSet);
+  m_DataResident = false;
+
+  emit arrayNamesChanged();
+  emit updatedOutputPort(this);
+  emit dataImported();
+  emit dataEvicted();
+
+  // Only flat images are restored by the view, so anything else is read right away
+  if(!canStreamData())
+  {
+    restoreData();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::restoreData()
+{
+  if(m_DataResident || m_WrappingWatcher.isRunning())
+  {
+    return;
+  }
+
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(getParentFilter());
+  if(nullptr == fileFilter)
+  {
+    return;
+  }
+
+  // Marked resident immediately so that a failed read is reported once rather than on every camera change
+  m_DataResident = true;
+  m_RestoringData = true;
+  m_WrappingWatcher.setFuture(QtConcurrent::run(this, &VSSIMPLDataContainerFilter::readEvictedData, fileFilter->getFilePath(), getFilterName()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::readEvictedData(const QString& filePath, const QString& dcName)
+{
+  DataContainer::Pointer dc;
+  {
+    QMutexLocker locker(&s_StreamReadLock);
+
+    SIMPLH5DataReader reader;
+    if(!reader.openFile(filePath))
+    {
+      QString ss = QObject::tr("Data Container '%1' could not be read from '%2'.").arg(dcName).arg(filePath);
+      emit errorGenerated("Data Streaming Error", ss, -3004);
+      return;
+    }
+
+    int err = 0;
+    DataContainerArrayProxy dcaProxy = reader.readDataContainerArrayStructure(nullptr, err);
+    QMap<QString, DataContainerProxy>& dataContainers = dcaProxy.getDataContainers();
+    if(!dataContainers.contains(dcName))
+    {
+      QString ss = QObject::tr("Data Container '%1' could not be read because it no longer exists in the underlying file '%2'.").arg(dcName).arg(filePath);
+      emit errorGenerated("Data Streaming Error", ss, -3001);
+      return;
+    }
+
+    DataContainerProxy dcProxy = dataContainers.value(dcName);
+    AttributeMatrixProxy::AMTypeFlags amFlags(AttributeMatrixProxy::AMTypeFlag::Cell_AMType);
+    DataArrayProxy::PrimitiveTypeFlags pFlags(DataArrayProxy::PrimitiveTypeFlag::Any_PType);
+    DataArrayProxy::CompDimsVector compDimsVector;
+
+    dcProxy.setFlags(Qt::Checked, amFlags, pFlags, compDimsVector);
+    dataContainers[dcProxy.getName()] = dcProxy;
+
+    DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(dcaProxy, false);
+    if(nullptr != dca)
+    {
+      dc = dca->getDataContainer(dcName);
+    }
+  }
+
+  if(nullptr == dc)
+  {
+    QString ss = QObject::tr("Data Container '%1' could not be read from '%2'.").arg(dcName).arg(filePath);
+    emit errorGenerated("Data Streaming Error", ss, -3004);
+    return;
+  }
+
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = SIMPLVtkBridge::WrapDataContainerAsStruct(dc);
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  // Restore the array selection made when the DataContainer was first imported
+  SIMPLVtkBridge::WrappedDataContainerPtr placeholder = m_DCValues->getWrappedDataContainer();
+  for(int i = 0; i < 3; i++)
+  {
+    wrappedDc->m_Origin[i] = placeholder->m_Origin[i];
+  }
+  wrappedDc->m_ImportCellArrays = placeholder->m_ImportCellArrays;
+  wrappedDc->m_ImportPointArrays = placeholder->m_ImportPointArrays;
+  SIMPLVtkBridge::FinishWrappingDataContainerStruct(wrappedDc);
+
+  m_DCValues->setWrappedDataContainer(wrappedDc);
+  m_DCValues->setFullyWrapped(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataArray) VSSIMPLDataContainerFilter::getPointDataArray(const QString& arrayName)
+{
+  VTK_PTR(vtkDataSet) dataSet = getOutput();
+  if(dataSet)
+  {
+    // Point arrays from vertex AttributeMatrices are already available
+    VTK_PTR(vtkDataArray) pointArray = dataSet->GetPointData()->GetArray(qPrintable(arrayName));
+    if(pointArray)
+    {
+      return pointArray;
+    }
+  }
+
+  return SIMPLVtkBridge::RequestPointDataArray(m_DCValues->getWrappedDataContainer(), arrayName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList VSSIMPLDataContainerFilter::getLazyPointDataArrayNames() const
+{
+  QStringList arrayNames;
+
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = m_DCValues->getWrappedDataContainer();
+  if(nullptr == wrappedDc)
+  {
+    return arrayNames;
+  }
+
+  for(const SIMPLVtkBridge::WrappedDataArrayPtr& wrappedCellData : wrappedDc->m_CellData)
+  {
+    if(wrappedDc->m_DerivedPointData.find(wrappedCellData->m_ArrayName) == wrappedDc->m_DerivedPointData.end())
+    {
+      arrayNames.push_back(wrappedCellData->m_ArrayName);
+    }
+  }
+
+  return arrayNames;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::releasePointData()
+{
+  SIMPLVtkBridge::ReleasePointDataArrays(m_DCValues->getWrappedDataContainer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::releaseTopology()
+{
+  SIMPLVtkBridge::ReleaseTopology(m_DCValues->getWrappedDataContainer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLVtkBridge::MemoryReport VSSIMPLDataContainerFilter::getMemoryReport() const
+{
+  return SIMPLVtkBridge::GetMemoryReport(m_DCValues->getWrappedDataContainer());
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -83,6 +83,14 @@ public:
    */
   bool isFlatImage() override;
 
+  /**
+   * @brief Returns true if the DataContainer has an image geometry that is one cell thick
+   * in at least one dimension.  Returns false otherwise.
+   * @param dc
+   * @return
+   */
+  static bool IsFlatImage(const DataContainerShPtrType& dc);
+
   /**
    * @brief Returns the bounds of the vtkDataSet
    * @return
@@ -166,6 +174,70 @@ public:
    */
   bool dataFullyLoaded();
 
+  /**
+   * @brief Returns true if the DataContainer is a flat image read from a .dream3d file
+   * and can therefore be evicted from memory and read again when needed.
+   * @return
+   */
+  bool canStreamData();
+
+  /**
+   * @brief Returns true if the DataContainer arrays are held in memory.  Returns false
+   * if they have been evicted and only the geometry is available.
+   * @return
+   */
+  bool isDataResident() const;
+
+  /**
+   * @brief Releases the DataContainer arrays and replaces the output with the geometry
+   * alone.  Views display an outline in place of the image until restoreData is called.
+   */
+  void evictData();
+
+  /**
+   * @brief Finishes importing a DataContainer that was read from its .dream3d file without
+   * its array values.  The filter starts out evicted with only its geometry, and restoreData
+   * reads the selected arrays from the file when a view needs them.  DataContainers that
+   * cannot be streamed are restored immediately.  This method is not thread safe.
+   */
+  void importEvicted();
+
+  /**
+   * @brief Reads evicted DataContainer arrays from the source .dream3d file on a separate thread.
+   * Emits dataRestored when the data is available again.
+   */
+  void restoreData();
+
+  /**
+   * @brief Returns the point data interpolated from the cell array with the given name.
+   * The array is only interpolated the first time it is requested and is cached until released.
+   * @param arrayName
+   * @return
+   */
+  VTK_PTR(vtkDataArray) getPointDataArray(const QString& arrayName) override;
+
+  /**
+   * @brief Returns the names of wrapped cell arrays whose point data has not been interpolated yet
+   * @return
+   */
+  QStringList getLazyPointDataArrayNames() const override;
+
+  /**
+   * @brief Releases any point data interpolated from the wrapped cell data
+   */
+  void releasePointData();
+
+  /**
+   * @brief Releases the point to cell links built by mapped mesh geometries
+   */
+  void releaseTopology();
+
+  /**
+   * @brief Returns the number of bytes shared with SIMPLib and copied by VTK for the wrapped DataContainer
+   * @return
+   */
+  SIMPLVtkBridge::MemoryReport getMemoryReport() const;
+
   /**
    * @brief Returns the filter values associated with the filter
    * @return
@@ -215,9 +287,19 @@ protected:
   void createFilter() override;
 
 private:
+  /**
+   * @brief Reads the DataContainer with the given name from the .dream3d file and wraps it.
+   * This is run on a separate thread when restoring evicted data.
+   * @param filePath
+   * @param dcName
+   */
+  void readEvictedData(const QString& filePath, const QString& dcName);
+
   VTK_PTR(vtkTrivialProducer) m_TrivialProducer = nullptr;
   QFutureWatcher<void> m_WrappingWatcher;
   QSemaphore m_ApplyLock;
   bool m_WrappingTransform = false;
+  bool m_DataResident = true;
+  bool m_RestoringData = false;
   VSSIMPLDataContainerValues* m_DCValues = nullptr;
 };
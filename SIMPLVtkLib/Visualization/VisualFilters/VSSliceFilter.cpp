@@ -87,7 +87,11 @@ VSSliceFilter* VSSliceFilter::Create(QJsonObject& json, VSAbstractFilter* parent
 void VSSliceFilter::createFilter()
 {
   m_SliceAlgorithm = vtkSmartPointer<vtkCutter>::New();
-  m_SliceAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+
+  // createApplyAlgorithm gives each apply a copy with its own partition algorithm factory
+  m_ParallelAlgorithm = VTK_PTR(VSParallelAlgorithm)::New();
+  m_ParallelAlgorithm->SetOutputType(VTK_POLY_DATA);
+  m_ParallelAlgorithm->SetAlgorithm(m_SliceAlgorithm);
   setConnectedInput(true);
 }
 
@@ -126,6 +130,25 @@ void VSSliceFilter::applyValues(VSSliceValues* values)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::previewValues(VSSliceValues* values)
+{
+  if(nullptr == m_SliceAlgorithm)
+  {
+    createFilter();
+  }
+
+  VTK_NEW(vtkPlane, plane);
+  plane->SetOrigin(values->getOrigin());
+  plane->SetNormal(values->getNormal());
+
+  VTK_NEW(vtkCutter, previewCutter);
+  previewCutter->SetCutFunction(plane);
+  startPreview(previewCutter);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -145,9 +168,7 @@ void VSSliceFilter::apply(double origin[3], double normal[3])
   planeWidget->SetNormal(normal);
 
   m_SliceAlgorithm->SetCutFunction(planeWidget);
-  m_SliceAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  startApply();
 }
 
 // -----------------------------------------------------------------------------
@@ -198,9 +219,9 @@ void VSSliceFilter::writeJson(QJsonObject& json)
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSSliceFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_SliceAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_SliceAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -215,9 +236,9 @@ vtkAlgorithmOutput* VSSliceFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSSliceFilter::getOutput() const
 {
-  if(getConnectedInput() && m_SliceAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_SliceAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -241,7 +262,8 @@ void VSSliceFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_SliceAlgorithm)
   {
-    m_SliceAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Recompute the output from the parent filter's new output
+    startApply();
   }
   else
   {
@@ -249,6 +271,38 @@ void VSSliceFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) VSSliceFilter::createApplyAlgorithm()
+{
+  if(nullptr == m_ParallelAlgorithm)
+  {
+    return nullptr;
+  }
+
+  // Copy the cut plane on the calling thread so that the worker never reads m_SliceAlgorithm
+  VTK_PTR(vtkImplicitFunction) cutFunction = m_SliceAlgorithm->GetCutFunction();
+  if(vtkPlane* plane = vtkPlane::SafeDownCast(m_SliceAlgorithm->GetCutFunction()))
+  {
+    VTK_NEW(vtkPlane, planeCopy);
+    planeCopy->SetOrigin(plane->GetOrigin());
+    planeCopy->SetNormal(plane->GetNormal());
+    cutFunction = planeCopy;
+  }
+
+  auto factory = [cutFunction]() -> VTK_PTR(vtkAlgorithm) {
+    VTK_NEW(vtkCutter, partitionCutter);
+    partitionCutter->SetCutFunction(cutFunction);
+    return partitionCutter;
+  };
+
+  VTK_PTR(VSParallelAlgorithm) algorithm = m_ParallelAlgorithm->CreateCopy();
+  algorithm->SetAlgorithm(factory());
+  algorithm->SetAlgorithmFactory(factory);
+  return algorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -43,6 +43,7 @@
 #include <vtkPlane.h>
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSParallelAlgorithm.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceValues.h"
 
 /**
@@ -106,6 +107,13 @@ public:
    */
   void applyValues(VSSliceValues* values);
 
+  /**
+   * @brief Slices a decimated copy of the input with the given values without
+   * changing the last applied values.  Used while the plane widget is being dragged.
+   * @param values
+   */
+  void previewValues(VSSliceValues* values);
+
   /**
    * @brief Applies the updated values to the algorithm and updates the output
    * @param origin
@@ -203,8 +211,15 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns a copy of the configured algorithm to run on a worker thread
+   * @return
+   */
+  VTK_PTR(vtkAlgorithm) createApplyAlgorithm() override;
+
 private:
   VTK_PTR(vtkCutter) m_SliceAlgorithm;
+  VTK_PTR(VSParallelAlgorithm) m_ParallelAlgorithm;
   VSSliceValues* m_SliceValues = nullptr;
 };
 
@@ -35,6 +35,9 @@
 
 #include "VSSliceValues.h"
 
+#include <QtWidgets/QCheckBox>
+#include <QtWidgets/QVBoxLayout>
+
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceFilter.h"
 
 // -----------------------------------------------------------------------------
@@ -45,6 +48,7 @@ VSSliceValues::VSSliceValues(VSSliceFilter* filter)
 , m_PlaneWidget(new VSPlaneWidget(nullptr, filter->getTransform(), filter->getBounds(), nullptr))
 {
   connect(m_PlaneWidget, &VSPlaneWidget::modified, this, &VSSliceValues::alertChangesWaiting);
+  connectPreviewWidget(m_PlaneWidget);
 
   m_PlaneWidget->setUsePlaneNormal(m_PlaneWidget->getNormal());
   m_PlaneWidget->setUsePlaneOrigin(m_PlaneWidget->getOrigin());
@@ -61,6 +65,8 @@ VSSliceValues::VSSliceValues(const VSSliceValues& values)
   m_PlaneWidget->setNormal(values.getNormal());
   m_PlaneWidget->setOrigin(values.getOrigin());
   connect(m_PlaneWidget, &VSPlaneWidget::modified, this, &VSSliceValues::alertChangesWaiting);
+  setLivePreviewEnabled(values.isLivePreviewEnabled());
+  connectPreviewWidget(m_PlaneWidget);
 
   m_PlaneWidget->setUsePlaneNormal(values.m_PlaneWidget->getUsePlaneNormal());
   m_PlaneWidget->setUsePlaneOrigin(values.m_PlaneWidget->getUsePlaneOrigin());
@@ -88,6 +94,22 @@ void VSSliceValues::applyValues()
   m_FreshFilter = false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceValues::previewValues()
+{
+  VSAbstractFilter::FilterListType filters = getSelection();
+  for(VSAbstractFilter* filter : filters)
+  {
+    FilterType* filterType = dynamic_cast<FilterType*>(filter);
+    if(filterType)
+    {
+      filterType->previewValues(this);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -183,7 +205,17 @@ void VSSliceValues::updateRendering()
 // -----------------------------------------------------------------------------
 QWidget* VSSliceValues::createFilterWidget()
 {
-  return m_PlaneWidget;
+  QWidget* filterWidget = new QWidget();
+  QVBoxLayout* layout = new QVBoxLayout(filterWidget);
+  layout->setSpacing(4);
+  layout->setContentsMargins(1, 1, 0, 0);
+
+  QCheckBox* livePreviewCheckBox = new QCheckBox("Live Preview", filterWidget);
+  connectLivePreviewCheckBox(livePreviewCheckBox);
+  layout->addWidget(livePreviewCheckBox);
+  layout->addWidget(m_PlaneWidget);
+
+  return filterWidget;
 }
 
 // -----------------------------------------------------------------------------
@@ -153,6 +153,11 @@ signals:
   void lastNormalChanged();
 
 protected:
+  /**
+   * @brief Previews the plane widget's current values on the selected filters
+   */
+  void previewValues() override;
+
   /**
    * @brief Updates the enabled state for the VSPlaneWidget
    */
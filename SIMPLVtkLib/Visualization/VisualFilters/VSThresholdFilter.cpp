@@ -42,6 +42,7 @@
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
 #include <vtkImplicitDataSet.h>
+#include <vtkInformation.h>
 #include <vtkPointData.h>
 #include <vtkThreshold.h>
 #include <vtkUnstructuredGrid.h>
@@ -90,13 +91,17 @@ void VSThresholdFilter::createFilter()
 {
   m_ThresholdAlgorithm = VTK_PTR(vtkThreshold)::New();
 
+  // createApplyAlgorithm gives each apply a copy with its own partition algorithm factory
+  m_ParallelAlgorithm = VTK_PTR(VSParallelAlgorithm)::New();
+  m_ParallelAlgorithm->SetOutputType(VTK_UNSTRUCTURED_GRID);
+  m_ParallelAlgorithm->SetAlgorithm(m_ThresholdAlgorithm);
+
   // Parent cell data required
   if(false == (getParentFilter() && getParentFilter()->getOutput() && getParentFilter()->getOutput()->GetCellData()))
   {
     return;
   }
 
-  m_ThresholdAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
   VTK_PTR(vtkDataArray) dataArray = getParentFilter()->getOutput()->GetCellData()->GetScalars();
 
   setConnectedInput(true);
@@ -154,9 +159,7 @@ void VSThresholdFilter::apply(QString arrayName, double min, double max)
 
   m_ThresholdAlgorithm->ThresholdBetween(min, max);
   m_ThresholdAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(arrayName));
-  m_ThresholdAlgorithm->Update();
-
-  emit updatedOutputPort(this);
+  startApply();
 }
 
 // -----------------------------------------------------------------------------
@@ -191,9 +194,9 @@ QUuid VSThresholdFilter::GetUuid()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSThresholdFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_ThresholdAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ThresholdAlgorithm->GetOutputPort();
+    return getAppliedOutputPort();
   }
   else if(getParentFilter())
   {
@@ -208,9 +211,9 @@ vtkAlgorithmOutput* VSThresholdFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSThresholdFilter::getOutput() const
 {
-  if(getConnectedInput() && m_ThresholdAlgorithm)
+  if(getConnectedInput() && hasAppliedOutput())
   {
-    return m_ThresholdAlgorithm->GetOutput();
+    return getAppliedOutput();
   }
   else if(getParentFilter())
   {
@@ -234,7 +237,8 @@ void VSThresholdFilter::updateAlgorithmInput(VSAbstractFilter* filter)
 
   if(getConnectedInput() && m_ThresholdAlgorithm)
   {
-    m_ThresholdAlgorithm->SetInputConnection(filter->getOutputPort());
+    // Recompute the output from the parent filter's new output
+    startApply();
   }
   else
   {
@@ -242,6 +246,35 @@ void VSThresholdFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAlgorithm) VSThresholdFilter::createApplyAlgorithm()
+{
+  if(nullptr == m_ParallelAlgorithm)
+  {
+    return nullptr;
+  }
+
+  // Copy the parameters on the calling thread so that the worker never reads m_ThresholdAlgorithm
+  double lower = m_ThresholdAlgorithm->GetLowerThreshold();
+  double upper = m_ThresholdAlgorithm->GetUpperThreshold();
+  VTK_NEW(vtkInformation, arrayInfo);
+  arrayInfo->Copy(m_ThresholdAlgorithm->GetInputArrayInformation(0), 1);
+
+  auto factory = [lower, upper, arrayInfo]() -> VTK_PTR(vtkAlgorithm) {
+    VTK_NEW(vtkThreshold, partitionThreshold);
+    partitionThreshold->ThresholdBetween(lower, upper);
+    partitionThreshold->SetInputArrayToProcess(0, arrayInfo);
+    return partitionThreshold;
+  };
+
+  VTK_PTR(VSParallelAlgorithm) algorithm = m_ParallelAlgorithm->CreateCopy();
+  algorithm->SetAlgorithm(factory());
+  algorithm->SetAlgorithmFactory(factory);
+  return algorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
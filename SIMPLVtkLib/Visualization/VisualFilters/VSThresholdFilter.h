@@ -40,6 +40,7 @@
 #include <vtkThreshold.h>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSParallelAlgorithm.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdValues.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -198,8 +199,15 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Returns a copy of the configured algorithm to run on a worker thread
+   * @return
+   */
+  VTK_PTR(vtkAlgorithm) createApplyAlgorithm() override;
+
 private:
   VTK_PTR(vtkThreshold) m_ThresholdAlgorithm;
+  VTK_PTR(VSParallelAlgorithm) m_ParallelAlgorithm;
   VSThresholdValues* m_ThresholdValues = nullptr;
 };
 
@@ -37,6 +37,8 @@
 
 #include <cmath>
 
+#include <QtCore/QMutexLocker>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -135,32 +137,64 @@ VSTransform* VSTransform::getParent() const
 double* VSTransform::getPosition()
 {
   double* position = new double[3];
-  getGlobalTransform()->GetPosition(position);
+  getPosition(position);
   return position;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getPosition(double position[3])
+{
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_GlobalCache->GetPosition(position);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 double* VSTransform::getLocalPosition()
 {
   double* position = new double[3];
-  m_LocalTransform->GetPosition(position);
+  getLocalPosition(position);
   return position;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getLocalPosition(double position[3])
+{
+  m_LocalTransform->GetPosition(position);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 double* VSTransform::getRotation()
+{
+  double* rotation = new double[3];
+  getRotation(rotation);
+  return rotation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getRotation(double rotation[3])
 {
   if(nullptr == m_Parent)
   {
-    return getLocalRotation();
+    getLocalRotation(rotation);
+    return;
   }
 
-  double* rotation = new double[3];
-  getGlobalTransform()->GetOrientation(rotation);
+  {
+    QMutexLocker locker(&m_GlobalLock);
+    updateGlobalCache();
+    m_GlobalCache->GetOrientation(rotation);
+  }
 
   for(int i = 0; i < 3; i++)
   {
@@ -169,8 +203,6 @@ double* VSTransform::getRotation()
       rotation[i] = 0.0;
     }
   }
-
-  return rotation;
 }
 
 // -----------------------------------------------------------------------------
@@ -179,6 +211,15 @@ double* VSTransform::getRotation()
 double* VSTransform::getLocalRotation()
 {
   double* rotation = new double[3];
+  getLocalRotation(rotation);
+  return rotation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getLocalRotation(double rotation[3])
+{
   m_LocalTransform->GetOrientation(rotation);
 
   for(int i = 0; i < 3; i++)
@@ -188,8 +229,6 @@ double* VSTransform::getLocalRotation()
       rotation[i] = 0.0;
     }
   }
-
-  return rotation;
 }
 
 // -----------------------------------------------------------------------------
@@ -198,20 +237,85 @@ double* VSTransform::getLocalRotation()
 double* VSTransform::getScale()
 {
   double* scale = new double[3];
-  getGlobalTransform()->GetScale(scale);
+  getScale(scale);
   return scale;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getScale(double scale[3])
+{
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_GlobalCache->GetScale(scale);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 double* VSTransform::getLocalScale()
 {
   double* scale = new double[3];
-  m_LocalTransform->GetScale(scale);
+  getLocalScale(scale);
   return scale;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getLocalScale(double scale[3])
+{
+  m_LocalTransform->GetScale(scale);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setLocalValues(VSTransform* other)
+{
+  if(nullptr == other || this == other)
+  {
+    return;
+  }
+
+  setLocalMatrix(other->m_LocalTransform->GetMatrix());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getLocalMatrix(vtkMatrix4x4* matrix)
+{
+  matrix->DeepCopy(m_LocalTransform->GetMatrix());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::setLocalMatrix(vtkMatrix4x4* matrix)
+{
+  m_LocalTransform->SetMatrix(matrix);
+
+  emit emitAll();
+  emit updatedLocalPosition();
+  emit updatedLocalRotation();
+  emit updatedLocalScale();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::concatenate(vtkMatrix4x4* delta)
+{
+  m_LocalTransform->Concatenate(delta);
+
+  emit emitAll();
+  emit updatedLocalPosition();
+  emit updatedLocalRotation();
+  emit updatedLocalScale();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -258,14 +362,76 @@ void VSTransform::scale(double amount[3])
 VTK_PTR(vtkTransform) VSTransform::getGlobalTransform()
 {
   VTK_NEW(vtkTransform, transform);
-  transform->DeepCopy(m_LocalTransform);
 
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  transform->SetMatrix(m_GlobalCache->GetMatrix());
+  return transform;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::getGlobalMatrix(vtkMatrix4x4* matrix)
+{
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  matrix->DeepCopy(m_GlobalCache->GetMatrix());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTransform::updateGlobalCache()
+{
+  // Parents are locked after their children so the lock order is always the same
+  unsigned long long parentVersion = 0;
+  VTK_PTR(vtkMatrix4x4) parentMatrix = nullptr;
   if(m_Parent)
   {
-    transform->SetInput(m_Parent->getGlobalTransform());
+    QMutexLocker parentLocker(&m_Parent->m_GlobalLock);
+    m_Parent->updateGlobalCache();
+    parentVersion = m_Parent->m_CacheVersion;
+    if(m_GlobalCache && m_CacheParent == m_Parent && m_CacheParentVersion == parentVersion && m_CacheLocalTime == m_LocalTransform->GetMTime())
+    {
+      return;
+    }
+    parentMatrix = VTK_PTR(vtkMatrix4x4)::New();
+    parentMatrix->DeepCopy(m_Parent->m_GlobalCache->GetMatrix());
+  }
+  else if(m_GlobalCache && nullptr == m_CacheParent && m_CacheLocalTime == m_LocalTransform->GetMTime())
+  {
+    return;
+  }
+
+  if(nullptr == m_GlobalCache)
+  {
+    m_GlobalCache = VTK_PTR(vtkTransform)::New();
+    m_LocalizeCache = VTK_PTR(vtkTransform)::New();
   }
 
-  return transform;
+  // The global matrix is the parent's global matrix followed by the local matrix
+  vtkMatrix4x4* localMatrix = m_LocalTransform->GetMatrix();
+  VTK_NEW(vtkMatrix4x4, globalMatrix);
+  if(parentMatrix)
+  {
+    vtkMatrix4x4::Multiply4x4(parentMatrix, localMatrix, globalMatrix);
+  }
+  else
+  {
+    globalMatrix->DeepCopy(localMatrix);
+  }
+
+  VTK_NEW(vtkMatrix4x4, localizeMatrix);
+  vtkMatrix4x4::Invert(globalMatrix, localizeMatrix);
+
+  m_GlobalCache->SetMatrix(globalMatrix);
+  m_LocalizeCache->SetMatrix(localizeMatrix);
+
+  m_CacheParent = m_Parent;
+  m_CacheParentVersion = parentVersion;
+  m_CacheLocalTime = m_LocalTransform->GetMTime();
+  m_CacheVersion++;
 }
 
 // -----------------------------------------------------------------------------
@@ -347,13 +513,8 @@ void VSTransform::setLocalValues(double position[3], double rotation[3], double
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getPositionVector()
 {
-  double* positionPtr = getPosition();
   std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = positionPtr[i];
-  }
-
+  getPosition(outputVector.data());
   return outputVector;
 }
 
@@ -362,13 +523,8 @@ std::vector<double> VSTransform::getPositionVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getRotationVector()
 {
-  double* rotationPtr = getRotation();
   std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = rotationPtr[i];
-  }
-
+  getRotation(outputVector.data());
   return outputVector;
 }
 
@@ -377,13 +533,8 @@ std::vector<double> VSTransform::getRotationVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getScaleVector()
 {
-  double* scalePtr = getScale();
   std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = scalePtr[i];
-  }
-
+  getScale(outputVector.data());
   return outputVector;
 }
 
@@ -392,13 +543,8 @@ std::vector<double> VSTransform::getScaleVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getLocalPositionVector()
 {
-  double* localPositionPtr = getLocalPosition();
   std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = localPositionPtr[i];
-  }
-
+  getLocalPosition(outputVector.data());
   return outputVector;
 }
 
@@ -407,13 +553,8 @@ std::vector<double> VSTransform::getLocalPositionVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getLocalRotationVector()
 {
-  double* localRotationPtr = getLocalRotation();
   std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = localRotationPtr[i];
-  }
-
+  getLocalRotation(outputVector.data());
   return outputVector;
 }
 
@@ -422,13 +563,8 @@ std::vector<double> VSTransform::getLocalRotationVector()
 // -----------------------------------------------------------------------------
 std::vector<double> VSTransform::getLocalScaleVector()
 {
-  double* localScalePtr = getLocalScale();
   std::vector<double> outputVector(3);
-  for(int i = 0; i < 3; i++)
-  {
-    outputVector[i] = localScalePtr[i];
-  }
-
+  getLocalScale(outputVector.data());
   return outputVector;
 }
 
@@ -527,9 +663,11 @@ void VSTransform::setLocalScale(double scale[3])
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkTransform) VSTransform::getLocalizeTransform()
 {
-  VTK_PTR(vtkTransform) transform = getGlobalTransform();
-  transform->Inverse();
+  VTK_NEW(vtkTransform, transform);
 
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  transform->SetMatrix(m_LocalizeCache->GetMatrix());
   return transform;
 }
 
@@ -559,7 +697,9 @@ VTK_PTR(vtkTransform) VSTransform::getTransposedTransform()
 // -----------------------------------------------------------------------------
 void VSTransform::localizePoint(double point[3])
 {
-  getLocalizeTransform()->TransformPoint(point, point);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_LocalizeCache->TransformPoint(point, point);
 }
 
 // -----------------------------------------------------------------------------
@@ -567,7 +707,9 @@ void VSTransform::localizePoint(double point[3])
 // -----------------------------------------------------------------------------
 void VSTransform::localizePoints(vtkPoints* points)
 {
-  getLocalizeTransform()->TransformPoints(points, points);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_LocalizeCache->TransformPoints(points, points);
 }
 
 // -----------------------------------------------------------------------------
@@ -575,7 +717,9 @@ void VSTransform::localizePoints(vtkPoints* points)
 // -----------------------------------------------------------------------------
 void VSTransform::localizeNormal(double normal[3])
 {
-  getLocalizeTransform()->TransformNormal(normal, normal);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_LocalizeCache->TransformNormal(normal, normal);
 }
 
 // -----------------------------------------------------------------------------
@@ -583,7 +727,9 @@ void VSTransform::localizeNormal(double normal[3])
 // -----------------------------------------------------------------------------
 void VSTransform::localizeNormals(vtkDataArray* normals)
 {
-  getLocalizeTransform()->TransformNormals(normals, normals);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_LocalizeCache->TransformNormals(normals, normals);
 }
 
 // -----------------------------------------------------------------------------
@@ -628,7 +774,9 @@ void VSTransform::localizeTransform(vtkTransform* transform)
 // -----------------------------------------------------------------------------
 void VSTransform::globalizePoint(double point[3])
 {
-  getGlobalizeTransform()->TransformPoint(point, point);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_GlobalCache->TransformPoint(point, point);
 }
 
 // -----------------------------------------------------------------------------
@@ -636,7 +784,9 @@ void VSTransform::globalizePoint(double point[3])
 // -----------------------------------------------------------------------------
 void VSTransform::globalizePoints(vtkPoints* points)
 {
-  getGlobalizeTransform()->TransformPoints(points, points);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_GlobalCache->TransformPoints(points, points);
 }
 
 // -----------------------------------------------------------------------------
@@ -644,7 +794,9 @@ void VSTransform::globalizePoints(vtkPoints* points)
 // -----------------------------------------------------------------------------
 void VSTransform::globalizeNormal(double normal[3])
 {
-  getGlobalizeTransform()->TransformNormal(normal, normal);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_GlobalCache->TransformNormal(normal, normal);
 }
 
 // -----------------------------------------------------------------------------
@@ -652,7 +804,9 @@ void VSTransform::globalizeNormal(double normal[3])
 // -----------------------------------------------------------------------------
 void VSTransform::globalizeNormals(vtkDataArray* normals)
 {
-  getGlobalizeTransform()->TransformNormals(normals, normals);
+  QMutexLocker locker(&m_GlobalLock);
+  updateGlobalCache();
+  m_GlobalCache->TransformNormals(normals, normals);
 }
 
 // -----------------------------------------------------------------------------
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 
 #include <vtkMatrix4x4.h>
@@ -155,41 +156,112 @@ public:
   void setLocalScaleVector(std::vector<double> scale);
 
   /**
-   * @brief Returns the transform's global position in 3D space
+   * @brief Returns a new array with the transform's global position in 3D space.
+   * The caller is responsible for deleting it.
    * @return
    */
   double* getPosition();
 
   /**
-   * @brief Returns the transform's local position in 3D space
+   * @brief Copies the transform's global position in 3D space
+   * @param position
+   */
+  void getPosition(double position[3]);
+
+  /**
+   * @brief Returns a new array with the transform's local position in 3D space.
+   * The caller is responsible for deleting it.
    * @return
    */
   double* getLocalPosition();
 
   /**
-   * @brief Returns the transform's global Euler rotation
+   * @brief Copies the transform's local position in 3D space
+   * @param position
+   */
+  void getLocalPosition(double position[3]);
+
+  /**
+   * @brief Returns a new array with the transform's global Euler rotation.
+   * The caller is responsible for deleting it.
    * @return
    */
   double* getRotation();
 
   /**
-   * @brief Returns the transform's local Euler rotation
+   * @brief Copies the transform's global Euler rotation
+   * @param rotation
+   */
+  void getRotation(double rotation[3]);
+
+  /**
+   * @brief Returns a new array with the transform's local Euler rotation.
+   * The caller is responsible for deleting it.
    * @return
    */
   double* getLocalRotation();
 
   /**
-   * @brief Returns the transform's global scale
+   * @brief Copies the transform's local Euler rotation
+   * @param rotation
+   */
+  void getLocalRotation(double rotation[3]);
+
+  /**
+   * @brief Returns a new array with the transform's global scale.
+   * The caller is responsible for deleting it.
    * @return
    */
   double* getScale();
 
   /**
-   * @brief Returns the transform's local scale
+   * @brief Copies the transform's global scale
+   * @param scale
+   */
+  void getScale(double scale[3]);
+
+  /**
+   * @brief Returns a new array with the transform's local scale.
+   * The caller is responsible for deleting it.
    * @return
    */
   double* getLocalScale();
 
+  /**
+   * @brief Copies the transform's local scale
+   * @param scale
+   */
+  void getLocalScale(double scale[3]);
+
+  /**
+   * @brief Copies the local position, rotation, and scale of the given transform.
+   * See setLocalMatrix for the signals emitted.
+   * @param other
+   */
+  void setLocalValues(VSTransform* other);
+
+  /**
+   * @brief Copies the local transformation matrix
+   * @param matrix
+   */
+  void getLocalMatrix(vtkMatrix4x4* matrix);
+
+  /**
+   * @brief Replaces the local transformation matrix.  Emits emitAll, which emits
+   * valuesChanged once for all three components, followed by updatedLocalPosition,
+   * updatedLocalRotation, and updatedLocalScale.
+   * @param matrix
+   */
+  void setLocalMatrix(vtkMatrix4x4* matrix);
+
+  /**
+   * @brief Concatenates the given matrix onto the local transformation.  This is
+   * equivalent to calling translate, rotate, or scale with the values used to build
+   * the matrix, but emits valuesChanged once.  See setLocalMatrix for the signals emitted.
+   * @param delta
+   */
+  void concatenate(vtkMatrix4x4* delta);
+
   /**
    * @brief Sets the transform's local position
    * @param position
@@ -234,11 +306,17 @@ public:
   void scale(double amount[3]);
 
   /**
-   * @brief Returns the vtkTransform describing the global position, rotation, and scale.
+   * @brief Returns a new vtkTransform describing the global position, rotation, and scale.
    * @return
    */
   VTK_PTR(vtkTransform) getGlobalTransform();
 
+  /**
+   * @brief Copies the global transformation matrix
+   * @param matrix
+   */
+  void getGlobalMatrix(vtkMatrix4x4* matrix);
+
   /**
    * @brief Localizes the given point from global space
    * @param point
@@ -424,6 +502,13 @@ protected:
    */
   static void updateTransform(vtkTransform* transform);
 
+  /**
+   * @brief Recomputes the cached global and localizing transforms if the local
+   * transform or any parent has changed since they were last computed.  Requires
+   * m_GlobalLock to be held.
+   */
+  void updateGlobalCache();
+
 private:
   VSTransform* m_Parent = nullptr;
 
@@ -431,4 +516,13 @@ private:
   double* m_OriginRotation;
   double* m_OriginScale;
   VTK_PTR(vtkTransform) m_LocalTransform;
+
+  // Global matrices are cached until the local transform or a parent changes
+  QMutex m_GlobalLock;
+  VTK_PTR(vtkTransform) m_GlobalCache;
+  VTK_PTR(vtkTransform) m_LocalizeCache;
+  VSTransform* m_CacheParent = nullptr;
+  vtkMTimeType m_CacheLocalTime = 0;
+  unsigned long long m_CacheParentVersion = 0;
+  unsigned long long m_CacheVersion = 0;
 };
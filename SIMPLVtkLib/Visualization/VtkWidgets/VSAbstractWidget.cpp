@@ -35,6 +35,11 @@
 
 #include "VSAbstractWidget.h"
 
+#include <vtkCallbackCommand.h>
+#include <vtkCommand.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -141,3 +146,47 @@ VSTransform* VSAbstractWidget::getVSTransform()
 {
   return m_Transform;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractWidget::isInteracting() const
+{
+  return m_Interacting;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractWidget::observeInteraction(vtkAbstractWidget* widget)
+{
+  VTK_NEW(vtkCallbackCommand, interactionCallback);
+  interactionCallback->SetCallback(&VSAbstractWidget::InteractionCallback);
+  interactionCallback->SetClientData(this);
+
+  widget->AddObserver(vtkCommand::StartInteractionEvent, interactionCallback);
+  widget->AddObserver(vtkCommand::EndInteractionEvent, interactionCallback);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractWidget::InteractionCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData)
+{
+  VSAbstractWidget* widget = static_cast<VSAbstractWidget*>(clientData);
+  if(nullptr == widget)
+  {
+    return;
+  }
+
+  if(vtkCommand::StartInteractionEvent == eventId)
+  {
+    widget->m_Interacting = true;
+    emit widget->interactionStarted();
+  }
+  else if(vtkCommand::EndInteractionEvent == eventId)
+  {
+    widget->m_Interacting = false;
+    emit widget->interactionEnded();
+  }
+}
@@ -43,6 +43,7 @@
 
 #include <vector>
 
+#include <vtkAbstractWidget.h>
 #include <vtkImplicitFunction.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkSmartPointer.h>
@@ -120,8 +121,16 @@ public:
    */
   virtual void writeJson(const QJsonObject& json) = 0;
 
+  /**
+   * @brief Returns true while the user is dragging the vtkWidget.  Returns false otherwise.
+   * @return
+   */
+  bool isInteracting() const;
+
 signals:
   void modified();
+  void interactionStarted();
+  void interactionEnded();
 
 protected slots:
   /**
@@ -164,12 +173,29 @@ protected:
    */
   VSTransform* getVSTransform();
 
+  /**
+   * @brief Emits interactionStarted and interactionEnded when the user grabs and
+   * releases the given vtkWidget
+   * @param widget
+   */
+  void observeInteraction(vtkAbstractWidget* widget);
+
   const double MIN_SIZE = 6.0;
 
 private:
+  /**
+   * @brief vtkCommand::StartInteractionEvent and EndInteractionEvent callback
+   * @param caller
+   * @param eventId
+   * @param clientData
+   * @param callData
+   */
+  static void InteractionCallback(vtkObject* caller, unsigned long eventId, void* clientData, void* callData);
+
   vtkRenderWindowInteractor* m_RenderWindowInteractor;
   VSTransform* m_Transform;
   double m_Bounds[6];
+  bool m_Interacting = false;
 };
 
 #ifdef __clang__
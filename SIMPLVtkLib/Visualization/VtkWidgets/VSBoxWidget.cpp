@@ -143,6 +143,7 @@ VSBoxWidget::VSBoxWidget(QWidget* parent, VSTransform* transform, double bounds[
   m_BoxWidget->SetInteractor(iren);
   m_BoxWidget->SetRepresentation(m_BoxRep);
   m_BoxWidget->AddObserver(vtkCommand::InteractionEvent, myCallback);
+  observeInteraction(m_BoxWidget);
 
   updateSpinBoxes();
 
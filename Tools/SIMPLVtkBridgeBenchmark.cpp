@@ -0,0 +1,848 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QEventLoop>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+#include <QtWidgets/QApplication>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSTextFilter.h"
+
+namespace
+{
+/**
+ * @brief Describes one synthetic DataContainerArray
+ */
+struct DatasetSpec
+{
+  QString m_Geometry;
+  size_t m_Size = 0;
+  int m_ArrayCount = 1;
+  int m_ComponentCount = 1;
+  QString m_Type;
+  int m_TileCount = 1;
+};
+
+/**
+ * @brief Timing and memory results for one benchmark case
+ */
+struct CaseResult
+{
+  std::vector<double> m_WallTimes;
+  size_t m_SharedBytes = 0;
+  size_t m_CopiedBytes = 0;
+  size_t m_ElementCount = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+const QStringList Geometries = {"Image", "RectGrid", "Vertex", "Edge", "Triangle", "Quad", "Tet"};
+const QStringList MeshGeometries = {"Vertex", "Edge", "Triangle", "Quad", "Tet"};
+const QStringList Types = {"int8", "uint8", "int16", "uint16", "int32", "uint32", "int64", "uint64", "float", "double"};
+const QStringList Benchmarks = {"wrap_array", "wrap_geometry", "finish_wrapping", "wrap_dca", "import", "filter_tree"};
+const QStringList TreeOperations = {"build", "index", "parent", "row_count", "descendants_cold", "descendants_warm"};
+
+// -----------------------------------------------------------------------------
+// Returns the peak resident set size of the process in bytes
+// -----------------------------------------------------------------------------
+size_t PeakResidentBytes()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return static_cast<size_t>(counters.PeakWorkingSetSize);
+  }
+  return 0;
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return static_cast<size_t>(usage.ru_maxrss);
+#else
+  // Linux reports kilobytes
+  return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Parses a comma separated list of positive integers
+// -----------------------------------------------------------------------------
+bool ParseSizeList(const QString& text, std::vector<size_t>& values)
+{
+  values.clear();
+  for(const QString& part : text.split(',', QString::SkipEmptyParts))
+  {
+    bool ok = false;
+    qulonglong value = part.trimmed().toULongLong(&ok);
+    if(!ok || 0 == value)
+    {
+      return false;
+    }
+    values.push_back(static_cast<size_t>(value));
+  }
+  return !values.empty();
+}
+
+// -----------------------------------------------------------------------------
+// Parses a comma separated list of names and checks them against the allowed values
+// -----------------------------------------------------------------------------
+bool ParseNameList(const QString& text, const QStringList& allowed, QStringList& values)
+{
+  values = text.split(',', QString::SkipEmptyParts);
+  for(QString& value : values)
+  {
+    value = value.trimmed();
+    if(!allowed.contains(value))
+    {
+      std::cerr << "Unknown value \"" << value.toStdString() << "\", expected one of " << allowed.join(',').toStdString() << std::endl;
+      return false;
+    }
+  }
+  return !values.empty();
+}
+
+// -----------------------------------------------------------------------------
+// Creates a DataArray with a deterministic fill so that every page is touched
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer CreateFilledArray(size_t numTuples, int numComps, const QString& name)
+{
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, std::vector<size_t>(1, static_cast<size_t>(numComps)), name, true);
+  T* values = array->getPointer(0);
+  size_t numValues = array->getSize();
+  for(size_t i = 0; i < numValues; i++)
+  {
+    values[i] = static_cast<T>(i % 127);
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer CreateArray(const QString& type, size_t numTuples, int numComps, const QString& name)
+{
+  if("int8" == type)
+  {
+    return CreateFilledArray<int8_t>(numTuples, numComps, name);
+  }
+  if("uint8" == type)
+  {
+    return CreateFilledArray<uint8_t>(numTuples, numComps, name);
+  }
+  if("int16" == type)
+  {
+    return CreateFilledArray<int16_t>(numTuples, numComps, name);
+  }
+  if("uint16" == type)
+  {
+    return CreateFilledArray<uint16_t>(numTuples, numComps, name);
+  }
+  if("int32" == type)
+  {
+    return CreateFilledArray<int32_t>(numTuples, numComps, name);
+  }
+  if("uint32" == type)
+  {
+    return CreateFilledArray<uint32_t>(numTuples, numComps, name);
+  }
+  if("int64" == type)
+  {
+    return CreateFilledArray<int64_t>(numTuples, numComps, name);
+  }
+  if("uint64" == type)
+  {
+    return CreateFilledArray<uint64_t>(numTuples, numComps, name);
+  }
+  if("double" == type)
+  {
+    return CreateFilledArray<double>(numTuples, numComps, name);
+  }
+  return CreateFilledArray<float>(numTuples, numComps, name);
+}
+
+// -----------------------------------------------------------------------------
+// Creates a vertex list for a regular grid of (nx, ny, nz) points offset along X
+// -----------------------------------------------------------------------------
+SharedVertexList::Pointer CreateGridVertices(size_t nx, size_t ny, size_t nz, float xOffset)
+{
+  SharedVertexList::Pointer vertices = IGeometry::CreateSharedVertexList(static_cast<int64_t>(nx * ny * nz), true);
+  float* coords = vertices->getPointer(0);
+  size_t index = 0;
+  for(size_t z = 0; z < nz; z++)
+  {
+    for(size_t y = 0; y < ny; y++)
+    {
+      for(size_t x = 0; x < nx; x++)
+      {
+        coords[index++] = xOffset + static_cast<float>(x);
+        coords[index++] = static_cast<float>(y);
+        coords[index++] = static_cast<float>(z);
+      }
+    }
+  }
+  return vertices;
+}
+
+// -----------------------------------------------------------------------------
+// Creates a geometry with approximately targetSize elements.  Returns the element count.
+// -----------------------------------------------------------------------------
+size_t CreateGeometry(const DataContainer::Pointer& dc, const QString& geomType, size_t targetSize, float xOffset)
+{
+  if("Image" == geomType)
+  {
+    size_t side = std::max<size_t>(1, static_cast<size_t>(std::round(std::cbrt(static_cast<double>(targetSize)))));
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(side, side, side));
+    image->setSpacing(FloatVec3Type(1.0f, 1.0f, 1.0f));
+    image->setOrigin(FloatVec3Type(xOffset, 0.0f, 0.0f));
+    dc->setGeometry(image);
+    return side * side * side;
+  }
+  if("RectGrid" == geomType)
+  {
+    size_t side = std::max<size_t>(1, static_cast<size_t>(std::round(std::cbrt(static_cast<double>(targetSize)))));
+    RectGridGeom::Pointer rectGrid = RectGridGeom::CreateGeometry(SIMPL::Geometry::RectGridGeometry);
+    rectGrid->setDimensions(SizeVec3Type(side, side, side));
+    FloatArrayType::Pointer bounds[3];
+    for(int i = 0; i < 3; i++)
+    {
+      bounds[i] = FloatArrayType::CreateArray(side + 1, QString("Bounds %1").arg(i), true);
+      for(size_t j = 0; j <= side; j++)
+      {
+        // Quadratic spacing keeps the grid rectilinear rather than uniform
+        float offset = (0 == i) ? xOffset : 0.0f;
+        bounds[i]->setValue(j, offset + static_cast<float>(j) + 0.01f * static_cast<float>(j * j) / static_cast<float>(side));
+      }
+    }
+    rectGrid->setXBounds(bounds[0]);
+    rectGrid->setYBounds(bounds[1]);
+    rectGrid->setZBounds(bounds[2]);
+    dc->setGeometry(rectGrid);
+    return side * side * side;
+  }
+  if("Vertex" == geomType)
+  {
+    size_t side = std::max<size_t>(1, static_cast<size_t>(std::round(std::cbrt(static_cast<double>(targetSize)))));
+    SharedVertexList::Pointer vertices = CreateGridVertices(side, side, side, xOffset);
+    dc->setGeometry(VertexGeom::CreateGeometry(vertices, SIMPL::Geometry::VertexGeometry));
+    return side * side * side;
+  }
+  if("Edge" == geomType)
+  {
+    // A polyline through a square grid of points
+    size_t side = std::max<size_t>(2, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(targetSize + 1)))));
+    size_t numEdges = side * side - 1;
+    SharedVertexList::Pointer vertices = CreateGridVertices(side, side, 1, xOffset);
+    EdgeGeom::Pointer edgeGeom = EdgeGeom::CreateGeometry(numEdges, vertices, SIMPL::Geometry::EdgeGeometry, true);
+    MeshIndexType* edges = edgeGeom->getEdgePointer(0);
+    for(size_t i = 0; i < numEdges; i++)
+    {
+      edges[i * 2] = i;
+      edges[i * 2 + 1] = i + 1;
+    }
+    dc->setGeometry(edgeGeom);
+    return numEdges;
+  }
+  if("Triangle" == geomType || "Quad" == geomType)
+  {
+    bool triangles = ("Triangle" == geomType);
+    double cellsPerSquare = triangles ? 2.0 : 1.0;
+    size_t cells = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(targetSize) / cellsPerSquare))));
+    size_t side = cells + 1;
+    SharedVertexList::Pointer vertices = CreateGridVertices(side, side, 1, xOffset);
+    size_t numSquares = cells * cells;
+
+    if(triangles)
+    {
+      TriangleGeom::Pointer triGeom = TriangleGeom::CreateGeometry(numSquares * 2, vertices, SIMPL::Geometry::TriangleGeometry, true);
+      MeshIndexType* tris = triGeom->getTriPointer(0);
+      size_t index = 0;
+      for(size_t y = 0; y < cells; y++)
+      {
+        for(size_t x = 0; x < cells; x++)
+        {
+          MeshIndexType v0 = y * side + x;
+          MeshIndexType v1 = v0 + 1;
+          MeshIndexType v2 = v0 + side;
+          MeshIndexType v3 = v2 + 1;
+          tris[index++] = v0;
+          tris[index++] = v1;
+          tris[index++] = v3;
+          tris[index++] = v0;
+          tris[index++] = v3;
+          tris[index++] = v2;
+        }
+      }
+      dc->setGeometry(triGeom);
+      return numSquares * 2;
+    }
+
+    QuadGeom::Pointer quadGeom = QuadGeom::CreateGeometry(numSquares, vertices, SIMPL::Geometry::QuadGeometry, true);
+    MeshIndexType* quads = quadGeom->getQuadPointer(0);
+    size_t index = 0;
+    for(size_t y = 0; y < cells; y++)
+    {
+      for(size_t x = 0; x < cells; x++)
+      {
+        MeshIndexType v0 = y * side + x;
+        quads[index++] = v0;
+        quads[index++] = v0 + 1;
+        quads[index++] = v0 + side + 1;
+        quads[index++] = v0 + side;
+      }
+    }
+    dc->setGeometry(quadGeom);
+    return numSquares;
+  }
+  if("Tet" == geomType)
+  {
+    // Each cube of the grid is split into six tetrahedra sharing its main diagonal
+    static const int CubeTets[6][4] = {{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7}, {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}};
+
+    size_t cells = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(targetSize) / 6.0))));
+    size_t side = cells + 1;
+    SharedVertexList::Pointer vertices = CreateGridVertices(side, side, side, xOffset);
+    size_t numTets = cells * cells * cells * 6;
+    TetrahedralGeom::Pointer tetGeom = TetrahedralGeom::CreateGeometry(numTets, vertices, SIMPL::Geometry::TetrahedralGeometry, true);
+    MeshIndexType* tets = tetGeom->getTetPointer(0);
+    size_t index = 0;
+    for(size_t z = 0; z < cells; z++)
+    {
+      for(size_t y = 0; y < cells; y++)
+      {
+        for(size_t x = 0; x < cells; x++)
+        {
+          MeshIndexType corners[8];
+          for(int c = 0; c < 8; c++)
+          {
+            corners[c] = ((z + ((c >> 2) & 1)) * side + (y + ((c >> 1) & 1))) * side + (x + (c & 1));
+          }
+          for(const auto& tet : CubeTets)
+          {
+            for(int v : tet)
+            {
+              tets[index++] = corners[v];
+            }
+          }
+        }
+      }
+    }
+    dc->setGeometry(tetGeom);
+    return numTets;
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Creates a DataContainerArray with one DataContainer per tile.  Returns the total element count.
+// -----------------------------------------------------------------------------
+size_t CreateDataContainerArray(const DatasetSpec& spec, DataContainerArray::Pointer& dca)
+{
+  dca = DataContainerArray::New();
+  size_t totalElements = 0;
+  for(int tile = 0; tile < spec.m_TileCount; tile++)
+  {
+    DataContainer::Pointer dc = DataContainer::New(QString("Tile %1").arg(tile));
+    float xOffset = static_cast<float>(tile) * 2.0f * static_cast<float>(std::cbrt(static_cast<double>(spec.m_Size)) + 1.0);
+    size_t numElements = CreateGeometry(dc, spec.m_Geometry, spec.m_Size, xOffset);
+    totalElements += numElements;
+
+    // Vertex geometries store their data per point
+    bool vertexGeom = ("Vertex" == spec.m_Geometry);
+    AttributeMatrix::Type amType = vertexGeom ? AttributeMatrix::Type::Vertex : AttributeMatrix::Type::Cell;
+    QString amName = vertexGeom ? QString("VertexData") : QString("CellData");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numElements), amName, amType);
+    for(int i = 0; i < spec.m_ArrayCount; i++)
+    {
+      am->insertOrAssign(CreateArray(spec.m_Type, numElements, spec.m_ComponentCount, QString("Array %1").arg(i)));
+    }
+    dc->addOrReplaceAttributeMatrix(am);
+    dca->addOrReplaceDataContainer(dc);
+  }
+  return totalElements;
+}
+
+// -----------------------------------------------------------------------------
+// Adds the shared and copied bytes from the wrapped DataContainers to the result
+// -----------------------------------------------------------------------------
+void AddMemoryReport(const SIMPLVtkBridge::WrappedDataContainerPtrCollection& wrappedDcs, CaseResult& result)
+{
+  result.m_SharedBytes = 0;
+  result.m_CopiedBytes = 0;
+  for(const SIMPLVtkBridge::MemoryReport& report : SIMPLVtkBridge::GetMemoryReport(wrappedDcs))
+  {
+    result.m_SharedBytes += report.m_SharedBytes;
+    result.m_CopiedBytes += report.m_CopiedBytes;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Runs the setup function untimed and the timed function once per repetition
+// -----------------------------------------------------------------------------
+void TimeRepeated(int repeat, const std::function<void()>& setup, const std::function<void()>& timed, CaseResult& result)
+{
+  for(int i = 0; i < repeat; i++)
+  {
+    if(setup)
+    {
+      setup();
+    }
+    Clock::time_point start = Clock::now();
+    timed();
+    Clock::time_point end = Clock::now();
+    result.m_WallTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Imports the DataContainerArray through a new VSController and blocks until every data filter has been applied
+// -----------------------------------------------------------------------------
+SIMPLVtkBridge::WrappedDataContainerPtrCollection ImportAndWait(const DataContainerArray::Pointer& dca, double& wallTime)
+{
+  VSController controller;
+  int expectedCount = 0;
+  int appliedCount = 0;
+  QEventLoop loop;
+
+  QObject::connect(&controller, &VSController::applyingDataFilters, &loop, [&expectedCount](int count) { expectedCount = count; });
+  QObject::connect(&controller, &VSController::dataFilterApplied, &loop, [&](int num) {
+    appliedCount = num;
+    if(appliedCount >= expectedCount)
+    {
+      loop.quit();
+    }
+  });
+
+  Clock::time_point start = Clock::now();
+  controller.importDataContainerArray(dca);
+  if(expectedCount > appliedCount)
+  {
+    loop.exec();
+  }
+  Clock::time_point end = Clock::now();
+  wallTime = std::chrono::duration<double, std::milli>(end - start).count();
+
+  SIMPLVtkBridge::WrappedDataContainerPtrCollection wrappedDcs;
+  for(VSAbstractFilter* filter : controller.getFilterModel()->getAllFilters())
+  {
+    VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(filter);
+    if(dcFilter)
+    {
+      wrappedDcs.push_back(dcFilter->getWrappedDataContainer());
+    }
+  }
+  return wrappedDcs;
+}
+
+// -----------------------------------------------------------------------------
+// Runs a single benchmark against the dataset and returns its results
+// -----------------------------------------------------------------------------
+CaseResult RunBenchmark(const QString& benchmark, const DataContainerArray::Pointer& dca, int repeat)
+{
+  CaseResult result;
+  SIMPLVtkBridge::WrappedDataContainerPtrCollection wrappedDcs;
+
+  if("wrap_array" == benchmark)
+  {
+    std::vector<IDataArray::Pointer> arrays;
+    for(const DataContainer::Pointer& dc : dca->getDataContainers())
+    {
+      for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+      {
+        for(const QString& arrayName : am->getAttributeArrayNames())
+        {
+          arrays.push_back(am->getAttributeArray(arrayName));
+        }
+      }
+    }
+
+    std::vector<VTK_PTR(vtkDataArray)> vtkArrays;
+    TimeRepeated(repeat, [&vtkArrays]() { vtkArrays.clear(); },
+                 [&arrays, &vtkArrays]() {
+                   for(const IDataArray::Pointer& array : arrays)
+                   {
+                     vtkArrays.push_back(SIMPLVtkBridge::WrapIDataArray(array));
+                   }
+                 },
+                 result);
+
+    // WrapIDataArray always references the SIMPLib buffer
+    for(const IDataArray::Pointer& array : arrays)
+    {
+      result.m_SharedBytes += array->getSize() * static_cast<size_t>(array->getTypeSize());
+    }
+    return result;
+  }
+
+  if("wrap_geometry" == benchmark)
+  {
+    TimeRepeated(repeat, [&wrappedDcs]() { wrappedDcs.clear(); },
+                 [&dca, &wrappedDcs]() {
+                   for(const DataContainer::Pointer& dc : dca->getDataContainers())
+                   {
+                     wrappedDcs.push_back(SIMPLVtkBridge::WrapGeometryPtr(dc));
+                   }
+                 },
+                 result);
+  }
+  else if("finish_wrapping" == benchmark)
+  {
+    TimeRepeated(repeat,
+                 [&dca, &wrappedDcs]() {
+                   wrappedDcs.clear();
+                   for(const DataContainer::Pointer& dc : dca->getDataContainers())
+                   {
+                     wrappedDcs.push_back(SIMPLVtkBridge::WrapGeometryPtr(dc));
+                   }
+                 },
+                 [&wrappedDcs]() {
+                   for(const SIMPLVtkBridge::WrappedDataContainerPtr& wrappedDc : wrappedDcs)
+                   {
+                     SIMPLVtkBridge::FinishWrappingDataContainerStruct(wrappedDc);
+                   }
+                 },
+                 result);
+  }
+  else if("wrap_dca" == benchmark)
+  {
+    TimeRepeated(repeat, [&wrappedDcs]() { wrappedDcs.clear(); }, [&dca, &wrappedDcs]() { wrappedDcs = SIMPLVtkBridge::WrapDataContainerArrayAsStruct(dca); }, result);
+  }
+  else if("import" == benchmark)
+  {
+    for(int i = 0; i < repeat; i++)
+    {
+      double wallTime = 0.0;
+      wrappedDcs = ImportAndWait(dca, wallTime);
+      result.m_WallTimes.push_back(wallTime);
+    }
+  }
+
+  AddMemoryReport(wrappedDcs, result);
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// Returns the milliseconds elapsed since the given time point
+// -----------------------------------------------------------------------------
+double ElapsedMilliseconds(const Clock::time_point& start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// -----------------------------------------------------------------------------
+// Builds a VSFilterModel with one VSFileNameFilter holding childCount children and times
+// the model lookups and descendant queries over it.  Returns one result per tree operation.
+// -----------------------------------------------------------------------------
+std::vector<CaseResult> RunFilterTreeBenchmark(size_t childCount, int repeat)
+{
+  std::vector<CaseResult> results(TreeOperations.size());
+  int rowCount = static_cast<int>(childCount);
+
+  for(int i = 0; i < repeat; i++)
+  {
+    // The model owns the filters through the root filter's QObject hierarchy
+    VSFilterModel* model = new VSFilterModel();
+
+    Clock::time_point start = Clock::now();
+    VSFileNameFilter* fileFilter = new VSFileNameFilter("benchmark.dream3d");
+    model->addFilter(fileFilter, false);
+    for(int row = 0; row < rowCount; row++)
+    {
+      VSTextFilter* textFilter = new VSTextFilter(fileFilter, QString::number(row), QString());
+      model->addFilter(textFilter, false);
+    }
+    results[0].m_WallTimes.push_back(ElapsedMilliseconds(start));
+
+    QModelIndex fileIndex = model->getIndexFromFilter(fileFilter);
+    std::vector<QModelIndex> childIndices(childCount);
+    start = Clock::now();
+    for(int row = 0; row < rowCount; row++)
+    {
+      childIndices[row] = model->index(row, 0, fileIndex);
+    }
+    results[1].m_WallTimes.push_back(ElapsedMilliseconds(start));
+
+    size_t parentMatches = 0;
+    start = Clock::now();
+    for(const QModelIndex& childIndex : childIndices)
+    {
+      parentMatches += (model->parent(childIndex) == fileIndex) ? 1 : 0;
+    }
+    results[2].m_WallTimes.push_back(ElapsedMilliseconds(start));
+
+    size_t rowTotal = 0;
+    start = Clock::now();
+    rowTotal += static_cast<size_t>(model->rowCount(fileIndex));
+    for(const QModelIndex& childIndex : childIndices)
+    {
+      rowTotal += static_cast<size_t>(model->rowCount(childIndex));
+    }
+    results[3].m_WallTimes.push_back(ElapsedMilliseconds(start));
+
+    // The first query after building fills the descendants cache, the second reads it
+    start = Clock::now();
+    size_t descendantCount = fileFilter->getDescendants().size();
+    results[4].m_WallTimes.push_back(ElapsedMilliseconds(start));
+
+    start = Clock::now();
+    descendantCount += fileFilter->getDescendants().size();
+    results[5].m_WallTimes.push_back(ElapsedMilliseconds(start));
+
+    if(parentMatches != childCount || rowTotal != childCount || descendantCount != 2 * childCount)
+    {
+      std::cerr << "Unexpected filter tree: " << parentMatches << " parents, " << rowTotal << " rows, " << descendantCount << " descendants" << std::endl;
+    }
+
+    delete model;
+  }
+
+  for(CaseResult& result : results)
+  {
+    result.m_ElementCount = childCount;
+  }
+  return results;
+}
+
+// -----------------------------------------------------------------------------
+// Adds the min, median, mean, and max wall times to the JSON object
+// -----------------------------------------------------------------------------
+void AddWallTimes(std::vector<double>& times, QJsonObject& json)
+{
+  std::sort(times.begin(), times.end());
+  double total = std::accumulate(times.begin(), times.end(), 0.0);
+  size_t mid = times.size() / 2;
+  double median = (times.size() % 2 == 1) ? times[mid] : 0.5 * (times[mid - 1] + times[mid]);
+
+  json["wall_ms_min"] = times.front();
+  json["wall_ms_median"] = median;
+  json["wall_ms_mean"] = total / static_cast<double>(times.size());
+  json["wall_ms_max"] = times.back();
+}
+
+// -----------------------------------------------------------------------------
+// Formats a filter tree result as a single JSON line
+// -----------------------------------------------------------------------------
+QJsonObject CreateTreeResultObject(const QString& operation, int repeat, CaseResult& result)
+{
+  QJsonObject json;
+  json["benchmark"] = QString("filter_tree");
+  json["operation"] = operation;
+  json["children"] = static_cast<double>(result.m_ElementCount);
+  json["repeat"] = repeat;
+  AddWallTimes(result.m_WallTimes, json);
+  json["peak_rss_bytes"] = static_cast<double>(PeakResidentBytes());
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+// Formats a case result as a single JSON line
+// -----------------------------------------------------------------------------
+QJsonObject CreateResultObject(const QString& benchmark, const DatasetSpec& spec, const QString& geometryMode, int repeat, CaseResult& result)
+{
+  QJsonObject json;
+  json["benchmark"] = benchmark;
+  json["geometry"] = spec.m_Geometry;
+  json["geometry_mode"] = geometryMode;
+  json["size"] = static_cast<double>(spec.m_Size);
+  json["elements"] = static_cast<double>(result.m_ElementCount);
+  json["arrays"] = spec.m_ArrayCount;
+  json["components"] = spec.m_ComponentCount;
+  json["type"] = spec.m_Type;
+  json["tiles"] = spec.m_TileCount;
+  json["repeat"] = repeat;
+  AddWallTimes(result.m_WallTimes, json);
+  json["shared_bytes"] = static_cast<double>(result.m_SharedBytes);
+  json["copied_bytes"] = static_cast<double>(result.m_CopiedBytes);
+  json["peak_rss_bytes"] = static_cast<double>(PeakResidentBytes());
+  return json;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  // Imported filters create Qt objects but nothing is shown
+  if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+  {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  QApplication app(argc, argv);
+  QApplication::setApplicationName("SIMPLVtkBridgeBenchmark");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Times SIMPLVtkBridge wrapping and VSConcurrentImport on synthetic data.  "
+                                   "Prints one JSON object per case.  Peak RSS is process wide, so run one case per "
+                                   "process to compare memory use.");
+  parser.addHelpOption();
+  QCommandLineOption benchmarkOption("benchmarks", "Benchmarks to run: " + Benchmarks.join(','), "list", Benchmarks.join(','));
+  QCommandLineOption geometryOption("geometries", "Geometries to generate: " + Geometries.join(','), "list", Geometries.join(','));
+  QCommandLineOption sizeOption("sizes", "Approximate element counts per DataContainer.", "list", "10000,100000,1000000");
+  QCommandLineOption arrayOption("arrays", "Number of cell arrays per DataContainer.", "list", "1,4");
+  QCommandLineOption componentOption("components", "Number of components per array.", "list", "1,3");
+  QCommandLineOption typeOption("types", "Array types: " + Types.join(','), "list", "uint8,float");
+  QCommandLineOption tileOption("tiles", "Number of DataContainers for the import benchmark.", "list", "1,4,16");
+  QCommandLineOption modeOption("geometry-modes", "Mesh geometry modes: Mapped,Native", "list", "Mapped,Native");
+  QCommandLineOption repeatOption("repeat", "Timed repetitions per case.", "count", "5");
+  QCommandLineOption treeChildOption("tree-children", "Number of child filters for the filter_tree benchmark.", "list", "10000");
+  parser.addOptions({benchmarkOption, geometryOption, sizeOption, arrayOption, componentOption, typeOption, tileOption, modeOption, repeatOption, treeChildOption});
+  parser.process(app);
+
+  QStringList benchmarks;
+  QStringList geometries;
+  QStringList types;
+  QStringList modes;
+  std::vector<size_t> sizes;
+  std::vector<size_t> arrayCounts;
+  std::vector<size_t> componentCounts;
+  std::vector<size_t> tileCounts;
+  std::vector<size_t> treeChildCounts;
+  bool repeatOk = false;
+  int repeat = parser.value(repeatOption).toInt(&repeatOk);
+  if(!ParseNameList(parser.value(benchmarkOption), Benchmarks, benchmarks) || !ParseNameList(parser.value(geometryOption), Geometries, geometries) ||
+     !ParseNameList(parser.value(typeOption), Types, types) || !ParseNameList(parser.value(modeOption), {"Mapped", "Native"}, modes) || !ParseSizeList(parser.value(sizeOption), sizes) ||
+     !ParseSizeList(parser.value(arrayOption), arrayCounts) || !ParseSizeList(parser.value(componentOption), componentCounts) || !ParseSizeList(parser.value(tileOption), tileCounts) ||
+     !ParseSizeList(parser.value(treeChildOption), treeChildCounts) || !repeatOk || repeat <= 0)
+  {
+    std::cerr << "Invalid arguments" << std::endl;
+    return 2;
+  }
+
+  // The filter tree does not depend on the synthetic datasets
+  if(benchmarks.removeAll("filter_tree") > 0)
+  {
+    for(size_t childCount : treeChildCounts)
+    {
+      std::vector<CaseResult> results = RunFilterTreeBenchmark(childCount, repeat);
+      for(int i = 0; i < TreeOperations.size(); i++)
+      {
+        QJsonObject json = CreateTreeResultObject(TreeOperations[i], repeat, results[i]);
+        std::cout << QJsonDocument(json).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+      }
+    }
+  }
+
+  for(const QString& geometry : geometries)
+  {
+    // Only mesh geometries are affected by the geometry mode
+    QStringList geometryModes = MeshGeometries.contains(geometry) ? modes : QStringList({"Default"});
+    for(const QString& geometryMode : geometryModes)
+    {
+      SIMPLVtkBridge::SetGeometryMode("Native" == geometryMode ? SIMPLVtkBridge::GeometryMode::Native : SIMPLVtkBridge::GeometryMode::Mapped);
+
+      for(size_t size : sizes)
+      {
+        for(size_t arrayCount : arrayCounts)
+        {
+          for(size_t componentCount : componentCounts)
+          {
+            for(const QString& type : types)
+            {
+              for(const QString& benchmark : benchmarks)
+              {
+                // Only the import benchmark sweeps the tile count
+                std::vector<size_t> benchmarkTiles = ("import" == benchmark) ? tileCounts : std::vector<size_t>(1, 1);
+                for(size_t tileCount : benchmarkTiles)
+                {
+                  DatasetSpec spec;
+                  spec.m_Geometry = geometry;
+                  spec.m_Size = size;
+                  spec.m_ArrayCount = static_cast<int>(arrayCount);
+                  spec.m_ComponentCount = static_cast<int>(componentCount);
+                  spec.m_Type = type;
+                  spec.m_TileCount = static_cast<int>(tileCount);
+
+                  DataContainerArray::Pointer dca;
+                  size_t elementCount = CreateDataContainerArray(spec, dca);
+
+                  CaseResult result = RunBenchmark(benchmark, dca, repeat);
+                  result.m_ElementCount = elementCount;
+
+                  QJsonObject json = CreateResultObject(benchmark, spec, geometryMode, repeat, result);
+                  std::cout << QJsonDocument(json).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,350 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+#include <QtWidgets/QApplication>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReader.h"
+
+#include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSOffscreenRenderer.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceFilter.h"
+
+namespace
+{
+enum ExitCode
+{
+  Success = 0,
+  ChecksumMismatch = 1,
+  InvalidArguments = 2,
+  LoadFailed = 3,
+  FilterFailed = 4,
+  WriteFailed = 5
+};
+
+// -----------------------------------------------------------------------------
+// Parses a comma separated list of three doubles
+// -----------------------------------------------------------------------------
+bool ParseVector3(const QString& text, std::vector<double>& values)
+{
+  QStringList parts = text.split(',');
+  if(parts.size() != 3)
+  {
+    return false;
+  }
+
+  values.resize(3);
+  for(int i = 0; i < 3; i++)
+  {
+    bool ok = false;
+    values[i] = parts[i].trimmed().toDouble(&ok);
+    if(!ok)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Reads every DataContainer, AttributeMatrix, and DataArray in a .dream3d file
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer ReadDataContainerArray(const QString& filePath)
+{
+  SIMPLH5DataReader reader;
+  if(!reader.openFile(filePath))
+  {
+    return DataContainerArray::NullPointer();
+  }
+
+  int err = 0;
+  DataContainerArrayProxy proxy = reader.readDataContainerArrayStructure(nullptr, err);
+  if(err < 0)
+  {
+    return DataContainerArray::NullPointer();
+  }
+
+  proxy.setAllFlags(Qt::Checked);
+  return reader.readSIMPLDataUsingProxy(proxy, false);
+}
+
+// -----------------------------------------------------------------------------
+// Imports the DataContainerArray and blocks until every data filter has been applied.
+// Returns false if the data filters were not applied before the timeout expired.
+// -----------------------------------------------------------------------------
+bool ImportAndWait(VSController* controller, const QString& filePath, const DataContainerArray::Pointer& dca, int timeoutMs)
+{
+  int expectedCount = 0;
+  int appliedCount = 0;
+  bool timedOut = false;
+  QEventLoop loop;
+
+  QObject::connect(controller, &VSController::applyingDataFilters, &loop, [&expectedCount](int count) { expectedCount = count; });
+  QObject::connect(controller, &VSController::dataFilterApplied, &loop, [&](int num) {
+    appliedCount = num;
+    if(appliedCount >= expectedCount)
+    {
+      loop.quit();
+    }
+  });
+
+  // VSConcurrentImport emits applyingDataFilters before returning when there is anything to import
+  controller->importDataContainerArray(filePath, dca);
+  if(expectedCount > appliedCount)
+  {
+    // A DataContainer that fails to import never reports being applied
+    QTimer deadline;
+    deadline.setSingleShot(true);
+    QObject::connect(&deadline, &QTimer::timeout, &loop, [&]() {
+      timedOut = true;
+      loop.quit();
+    });
+    deadline.start(timeoutMs);
+    loop.exec();
+  }
+
+  return !timedOut;
+}
+
+// -----------------------------------------------------------------------------
+// Adds a slice or clip filter to every data filter and hides the parent filters
+// -----------------------------------------------------------------------------
+bool ApplyPlaneFilters(VSController* controller, VSOffscreenRenderer* renderer, bool slice, const std::vector<double>& origin, const std::vector<double>& normal)
+{
+  VSFilterModel* filterModel = controller->getFilterModel();
+  VSAbstractFilter::FilterListType dataFilters;
+  for(VSAbstractFilter* baseFilter : filterModel->getBaseFilters())
+  {
+    for(VSAbstractFilter* child : baseFilter->getChildren())
+    {
+      dataFilters.push_back(child);
+    }
+  }
+
+  for(VSAbstractFilter* parent : dataFilters)
+  {
+    VSAbstractFilter* filter = nullptr;
+    if(slice && VSSliceFilter::CompatibleWithParent(parent))
+    {
+      VSSliceFilter* sliceFilter = new VSSliceFilter(parent);
+      filterModel->addFilter(sliceFilter, false);
+      sliceFilter->apply(origin, normal);
+      filter = sliceFilter;
+    }
+    else if(!slice && VSClipFilter::CompatibleWithParent(parent))
+    {
+      VSClipFilter* clipFilter = new VSClipFilter(parent);
+      filterModel->addFilter(clipFilter, false);
+      clipFilter->apply(origin, normal);
+      filter = clipFilter;
+    }
+
+    if(nullptr == filter)
+    {
+      continue;
+    }
+    if(!filter->waitForApply())
+    {
+      return false;
+    }
+
+    VSFilterViewSettings* parentSettings = renderer->getFilterViewModel()->getFilterViewSettings(parent);
+    if(parentSettings)
+    {
+      parentSettings->setVisible(false);
+    }
+  }
+
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  // Allow the harness to run without a display server
+  if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+  {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  QApplication app(argc, argv);
+  QApplication::setApplicationName("SIMPLVtkRenderHarness");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Renders a .dream3d file offscreen and reports frame times and an image checksum.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("file", "The .dream3d file to render.");
+  QCommandLineOption sliceOption("slice", "Slice every data filter with the plane <origin;normal>, e.g. \"0,0,0;0,0,1\".", "plane");
+  QCommandLineOption clipOption("clip", "Clip every data filter with the plane <origin;normal>, e.g. \"0,0,0;0,0,1\".", "plane");
+  QCommandLineOption widthOption("width", "Image width in pixels.", "pixels", "800");
+  QCommandLineOption heightOption("height", "Image height in pixels.", "pixels", "600");
+  QCommandLineOption framesOption("frames", "Number of timed frames to render.", "count", "10");
+  QCommandLineOption outputOption("output", "Write the final frame to a PNG image.", "path");
+  QCommandLineOption expectOption("expect-checksum", "Exit with an error if the image checksum does not match.", "md5");
+  QCommandLineOption timeoutOption("timeout", "Seconds to wait for the data to be imported.", "seconds", "300");
+  parser.addOptions({sliceOption, clipOption, widthOption, heightOption, framesOption, outputOption, expectOption, timeoutOption});
+  parser.process(app);
+
+  QStringList positionalArgs = parser.positionalArguments();
+  if(positionalArgs.size() != 1 || (parser.isSet(sliceOption) && parser.isSet(clipOption)))
+  {
+    parser.showHelp(InvalidArguments);
+  }
+
+  bool widthOk = false;
+  bool heightOk = false;
+  bool framesOk = false;
+  bool timeoutOk = false;
+  int width = parser.value(widthOption).toInt(&widthOk);
+  int height = parser.value(heightOption).toInt(&heightOk);
+  int frames = parser.value(framesOption).toInt(&framesOk);
+  int timeout = parser.value(timeoutOption).toInt(&timeoutOk);
+  if(!widthOk || !heightOk || !framesOk || !timeoutOk || width <= 0 || height <= 0 || frames <= 0 || timeout <= 0)
+  {
+    std::cerr << "Invalid image size, frame count, or timeout" << std::endl;
+    return InvalidArguments;
+  }
+
+  bool usePlane = parser.isSet(sliceOption) || parser.isSet(clipOption);
+  std::vector<double> origin;
+  std::vector<double> normal;
+  if(usePlane)
+  {
+    QStringList plane = parser.value(parser.isSet(sliceOption) ? sliceOption : clipOption).split(';');
+    if(plane.size() != 2 || !ParseVector3(plane[0], origin) || !ParseVector3(plane[1], normal))
+    {
+      std::cerr << "Invalid plane, expected \"ox,oy,oz;nx,ny,nz\"" << std::endl;
+      return InvalidArguments;
+    }
+  }
+
+  QString filePath = QFileInfo(positionalArgs[0]).absoluteFilePath();
+  DataContainerArray::Pointer dca = ReadDataContainerArray(filePath);
+  if(nullptr == dca)
+  {
+    std::cerr << "Could not read " << filePath.toStdString() << std::endl;
+    return LoadFailed;
+  }
+
+  VSController controller;
+  VSOffscreenRenderer renderer;
+  renderer.setController(&controller);
+  renderer.setSize(width, height);
+
+  if(!ImportAndWait(&controller, filePath, dca, timeout * 1000))
+  {
+    std::cerr << "Timed out importing " << filePath.toStdString() << std::endl;
+    return LoadFailed;
+  }
+  if(usePlane && !ApplyPlaneFilters(&controller, &renderer, parser.isSet(sliceOption), origin, normal))
+  {
+    std::cerr << "Could not apply the requested filter" << std::endl;
+    return FilterFailed;
+  }
+
+  // Process queued view settings updates before rendering
+  QApplication::processEvents();
+  renderer.resetCamera();
+
+  // The first frame includes one-time setup such as shader compilation
+  double firstFrameTime = renderer.render();
+
+  double minTime = std::numeric_limits<double>::max();
+  double maxTime = 0.0;
+  double totalTime = 0.0;
+  QJsonArray frameTimes;
+  for(int i = 0; i < frames; i++)
+  {
+    double frameTime = renderer.render();
+    minTime = std::min(minTime, frameTime);
+    maxTime = std::max(maxTime, frameTime);
+    totalTime += frameTime;
+    frameTimes.append(frameTime);
+  }
+
+  QByteArray checksum = renderer.getImageChecksum();
+
+  QJsonObject result;
+  result["file"] = filePath;
+  result["width"] = width;
+  result["height"] = height;
+  result["filters"] = static_cast<int>(controller.getFilterModel()->getAllFilters().size());
+  result["first_frame_ms"] = firstFrameTime;
+  result["min_frame_ms"] = minTime;
+  result["mean_frame_ms"] = totalTime / frames;
+  result["max_frame_ms"] = maxTime;
+  result["frame_ms"] = frameTimes;
+  result["checksum"] = QString::fromLatin1(checksum);
+
+  int exitCode = Success;
+  if(parser.isSet(outputOption) && !renderer.saveImage(parser.value(outputOption)))
+  {
+    std::cerr << "Could not write " << parser.value(outputOption).toStdString() << std::endl;
+    exitCode = WriteFailed;
+  }
+
+  if(parser.isSet(expectOption))
+  {
+    bool matches = (parser.value(expectOption).toLatin1().toLower() == checksum);
+    result["checksum_matches"] = matches;
+    if(!matches && Success == exitCode)
+    {
+      exitCode = ChecksumMismatch;
+    }
+  }
+
+  std::cout << QJsonDocument(result).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+  return exitCode;
+}
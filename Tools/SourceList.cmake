@@ -0,0 +1,16 @@
+
+#------------------------------------------------------------------------------
+# Command line tools that exercise SIMPLVtkLib without the GUI
+#------------------------------------------------------------------------------
+add_executable(SIMPLVtkRenderHarness ${SIMPLVtkLib_SOURCE_DIR}/Tools/SIMPLVtkRenderHarness.cpp)
+target_link_libraries(SIMPLVtkRenderHarness SIMPLVtkLib)
+set_target_properties(SIMPLVtkRenderHarness
+                          PROPERTIES FOLDER SIMPLVtkLib/Tools)
+
+add_executable(SIMPLVtkBridgeBenchmark ${SIMPLVtkLib_SOURCE_DIR}/Tools/SIMPLVtkBridgeBenchmark.cpp)
+target_link_libraries(SIMPLVtkBridgeBenchmark SIMPLVtkLib)
+if(WIN32)
+  target_link_libraries(SIMPLVtkBridgeBenchmark psapi)
+endif()
+set_target_properties(SIMPLVtkBridgeBenchmark
+                          PROPERTIES FOLDER SIMPLVtkLib/Tools)